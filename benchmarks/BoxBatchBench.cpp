@@ -0,0 +1,99 @@
+// Compares the per-rectangle intersection loop with BoxBatch's kernels.
+// Prints nanoseconds per query for a few batch sizes.
+
+#include "collision/BoxBatch.hpp"
+#include "utils/Random.hpp"
+#include "utils/Rectangle.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace tank;
+
+namespace {
+
+constexpr int QUERY_COUNT = 4096;
+constexpr int ROUNDS = 64;
+
+// Keeps results alive so the loops are not optimized away
+volatile std::uint64_t sink = 0;
+
+Rectangle randomBox(RandomStream& random, float size) {
+    return Rectangle(random.nextFloat() * 442.0f, random.nextFloat() * 442.0f, size, size);
+}
+
+template<typename Body>
+double nanosPerQuery(Body&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    std::uint64_t hits = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        hits += body();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    sink = sink + hits;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (ROUNDS * QUERY_COUNT);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "BoxBatch: one query box against N boxes, ns per query"
+              << " (detected kernel: " << BoxBatch::getKernelName(BoxBatch::getKernel()) << ")\n";
+    std::cout << std::setw(8) << "N" << std::setw(14) << "rect loop";
+    for (BoxKernel kernel : {BoxKernel::Scalar, BoxKernel::SSE2, BoxKernel::AVX2}) {
+        std::cout << std::setw(12) << BoxBatch::getKernelName(kernel);
+    }
+    std::cout << '\n';
+
+    const BoxKernel detected = BoxBatch::getKernel();
+    for (int count : {8, 32, 128, 512, 2048}) {
+        RandomStream random(static_cast<std::uint64_t>(count));
+        std::vector<Rectangle> boxes;
+        BoxBatch batch;
+        for (int i = 0; i < count; ++i) {
+            boxes.push_back(randomBox(random, 30.0f));
+            batch.add(boxes.back());
+        }
+        std::vector<Rectangle> queries;
+        for (int i = 0; i < QUERY_COUNT; ++i) {
+            queries.push_back(randomBox(random, 8.0f));
+        }
+
+        // The path the collision code used before: one intersects() per box
+        const double loop = nanosPerQuery([&] {
+            std::uint64_t hits = 0;
+            for (const Rectangle& query : queries) {
+                for (const Rectangle& box : boxes) {
+                    hits += box.intersects(query) ? 1 : 0;
+                }
+            }
+            return hits;
+        });
+        std::cout << std::setw(8) << count << std::setw(14) << std::fixed << std::setprecision(1) << loop;
+
+        std::vector<std::uint64_t> mask;
+        for (BoxKernel kernel : {BoxKernel::Scalar, BoxKernel::SSE2, BoxKernel::AVX2}) {
+            if (!BoxBatch::setKernel(kernel)) {
+                std::cout << std::setw(12) << "-";
+                continue;
+            }
+            const double batched = nanosPerQuery([&] {
+                std::uint64_t hits = 0;
+                for (const Rectangle& query : queries) {
+                    batch.intersectMask(query, mask);
+                    for (std::uint64_t word : mask) {
+                        hits += word != 0 ? 1 : 0;
+                    }
+                }
+                return hits;
+            });
+            std::cout << std::setw(12) << batched;
+        }
+        std::cout << '\n';
+    }
+    BoxBatch::setKernel(detected);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Compares one virtual update() per heap-allocated bullet with a single
+// BulletStore::advance() pass. Prints nanoseconds per bullet per tick.
+
+#include "core/EntityWorld.hpp"
+#include "entities/projectiles/Bullet.hpp"
+#include "entities/projectiles/BulletStore.hpp"
+#include "utils/Random.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace tank;
+
+namespace {
+
+constexpr int LEGS = 50;
+
+constexpr int TICKS_PER_LEG = 40;
+
+// Bullets fly TICKS_PER_LEG ticks one way and then back, so none leaves the
+// map and every tick moves all of them
+void turnAround(std::vector<std::unique_ptr<Bullet>>& bullets) {
+    for (auto& bullet : bullets) {
+        bullet->setDirection(bullet->getDirection() == Direction::Up ? Direction::Down : Direction::Up);
+    }
+}
+
+std::vector<std::unique_ptr<Bullet>> makeBullets(int count, EntityWorld& world) {
+    RandomStream random(static_cast<std::uint64_t>(count));
+    std::vector<std::unique_ptr<Bullet>> bullets;
+    for (int i = 0; i < count; ++i) {
+        const Vector2 position(random.nextFloat() * (Constants::GAME_WIDTH - 8),
+                               TICKS_PER_LEG + random.nextFloat() * (Constants::GAME_HEIGHT - 3 * TICKS_PER_LEG));
+        bullets.push_back(world.create<Bullet>(position, i % 2 ? Direction::Up : Direction::Down, nullptr));
+        bullets.back()->setSpeed(1.0f);
+    }
+    // Heap objects end up scattered in a long-running game; shuffle the
+    // update order to match
+    std::shuffle(bullets.begin(), bullets.end(), random);
+    return bullets;
+}
+
+template<typename Step>
+double nanosPerBullet(int count, Step&& step) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int leg = 0; leg < LEGS; ++leg) {
+        step();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (static_cast<double>(LEGS) * TICKS_PER_LEG * count);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Bullet advance, ns per bullet per tick\n";
+    std::cout << std::setw(8) << "N" << std::setw(14) << "update()" << std::setw(14) << "advance()" << '\n';
+
+    for (int count : {64, 256, 1024, 4096}) {
+        EntityWorld scattered;
+        auto objects = makeBullets(count, scattered);
+        const double perObject = nanosPerBullet(count, [&] {
+            for (int tick = 0; tick < TICKS_PER_LEG; ++tick) {
+                for (auto& bullet : objects) {
+                    if (bullet->isAlive()) {
+                        bullet->update(Constants::FIXED_DELTA_TIME);
+                    }
+                }
+            }
+            turnAround(objects);
+        });
+
+        EntityWorld storeWorld;
+        BulletStore& store = storeWorld.getBulletStore();
+        auto stored = makeBullets(count, storeWorld);
+        const double batched = nanosPerBullet(count, [&] {
+            for (int tick = 0; tick < TICKS_PER_LEG; ++tick) {
+                store.advance();
+            }
+            turnAround(stored);
+        });
+
+        std::cout << std::setw(8) << count << std::setw(14) << std::fixed << std::setprecision(2) << perObject
+                  << std::setw(14) << batched << '\n';
+    }
+    return 0;
+}
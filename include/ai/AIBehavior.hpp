@@ -2,13 +2,13 @@
 
 #include "ai/IAIBehavior.hpp"
 #include "utils/Constants.hpp"
+#include "utils/Random.hpp"
 #include <vector>
 #include <queue>
-#include <random>
 
 namespace tank {
 
-class Level;
+class TerrainMap;
 
 /**
  * @brief Simple random movement AI
@@ -16,6 +16,7 @@ class Level;
 class SimpleAI : public IAIBehavior {
 public:
     SimpleAI();
+    explicit SimpleAI(RandomStream random);
     ~SimpleAI() override = default;
 
     void update(EnemyTank& enemy, float deltaTime) override;
@@ -29,7 +30,7 @@ private:
     float fireTimer_;
     Direction currentDirection_;
 
-    std::mt19937 rng_;
+    RandomStream rng_;
 
     static constexpr float DIRECTION_CHANGE_TIME = 1.5f;
     static constexpr float FIRE_INTERVAL = 0.8f;
@@ -43,11 +44,13 @@ private:
 class PathfindingAI : public IAIBehavior {
 public:
     PathfindingAI();
+    explicit PathfindingAI(RandomStream random);
     ~PathfindingAI() override = default;
 
     void update(EnemyTank& enemy, float deltaTime) override;
     void setTarget(const Vector2& target) override { targetPos_ = target; }
-    void setLevel(Level* level) { level_ = level; }
+    // Paths are planned over the live terrain
+    void setTerrain(const TerrainMap* terrain) { terrain_ = terrain; }
 
     Type getType() const override { return Type::Pathfinding; }
 
@@ -61,14 +64,14 @@ private:
             : x(x), y(y), distance(d), dir(dir) {}
     };
 
-    Level* level_;
+    const TerrainMap* terrain_;
     Vector2 targetPos_;
     std::vector<Node> path_;
     int currentPathIndex_;
     float pathUpdateTimer_;
     float fireTimer_;
 
-    std::mt19937 rng_;
+    RandomStream rng_;
 
     static constexpr float PATH_UPDATE_INTERVAL = 2.0f;
     static constexpr float FIRE_INTERVAL = 1.0f;
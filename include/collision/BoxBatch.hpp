@@ -0,0 +1,75 @@
+#pragma once
+
+#include "utils/Rectangle.hpp"
+#include "utils/SimdLevel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tank {
+
+// Comparison implementation used by BoxBatch
+using BoxKernel = SimdLevel;
+
+/**
+ * @brief Axis-aligned boxes stored as separate edge arrays
+ *
+ * One query box is tested against up to 64 stored boxes per kernel call,
+ * four (SSE2) or eight (AVX2) at a time, and the result comes back as a
+ * hit mask. Overlap is strict, exactly as Rectangle::intersects. The arrays
+ * carry a tail of boxes that never overlap, so the vector kernels can load
+ * whole lanes past the last box.
+ */
+class BoxBatch {
+public:
+    BoxBatch();
+
+    void clear();
+    void reserve(std::size_t count);
+    // Returns the new box's index
+    std::size_t add(const Rectangle& box);
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    float getLeft(std::size_t index) const { return left_[index]; }
+
+    // Bit i of word w is set if box 64 * w + i overlaps query
+    void intersectMask(const Rectangle& query, std::vector<std::uint64_t>& mask) const;
+    bool anyIntersects(const Rectangle& query) const;
+    // Calls visit(index) for overlapping boxes in [begin, end), in order
+    template<typename Visit>
+    void forEachIntersecting(const Rectangle& query, std::size_t begin, std::size_t end, Visit&& visit) const;
+
+    // Kernel picked at startup from the CPU's features; tests and benchmarks
+    // can force another one. Returns false if the CPU cannot run it. Safe
+    // while other threads sweep; a block already under test finishes on the
+    // old kernel.
+    static BoxKernel getKernel();
+    static bool setKernel(BoxKernel kernel);
+    static const char* getKernelName(BoxKernel kernel);
+
+private:
+    static constexpr std::size_t PADDING = 8;  // One AVX2 lane
+
+    std::vector<float> left_;
+    std::vector<float> top_;
+    std::vector<float> right_;
+    std::vector<float> bottom_;
+    std::size_t size_ = 0;
+
+    // Hit mask for boxes [begin, begin + count), count <= 64
+    std::uint64_t testBlock(const Rectangle& query, std::size_t begin, std::size_t count) const;
+    static int lowestBit(std::uint64_t bits);
+};
+
+template<typename Visit>
+void BoxBatch::forEachIntersecting(const Rectangle& query, std::size_t begin, std::size_t end, Visit&& visit) const {
+    for (std::size_t block = begin; block < end; block += 64) {
+        std::uint64_t hits = testBlock(query, block, end - block < 64 ? end - block : 64);
+        while (hits) {
+            visit(block + static_cast<std::size_t>(lowestBit(hits)));
+            hits &= hits - 1;
+        }
+    }
+}
+
+} // namespace tank
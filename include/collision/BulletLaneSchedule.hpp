@@ -0,0 +1,105 @@
+#pragma once
+
+#include "entities/terrain/TerrainMap.hpp"
+#include "utils/Constants.hpp"
+#include "utils/FlatHashMap.hpp"
+#include "utils/Rectangle.hpp"
+#include "utils/Vector2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief Predicted static impacts of bullets, queued by the tick they fall due
+ *
+ * A bullet flies straight at a constant speed, so the first static obstacle
+ * on its lane (terrain or the base) is known as soon as it is fired. Each
+ * lane is traced once and queued by its due tick, and the collision pass
+ * only looks at lanes that are due. Static obstacles can only change through
+ * invalidate(), which marks the lanes crossing the changed area stale so
+ * they are traced again.
+ *
+ * Due ticks assume one move per tick and may come a tick early. Callers
+ * check the bullet's actual travel and reschedule if it is not there yet.
+ */
+class BulletLaneSchedule {
+public:
+    enum class Target : std::uint8_t { None, Base, Terrain };
+
+    struct Lane {
+        Vector2 origin;              // Bullet top-left when traced
+        Direction direction = Direction::Up;
+        float speed = 0.0f;
+        float impactDistance = 0.0f; // From origin along direction, unless Target::None
+        Target target = Target::None;
+        TerrainCell cell;            // The terrain hit, if Target::Terrain
+        Rectangle area;              // Swept path, reaching just past the impact
+        std::size_t bulletIndex = 0; // Refreshed by touch() every tick
+        std::uint32_t version = 0;
+        std::int64_t seenTick = 0;
+        bool stale = false;
+    };
+
+    // How far a lane is traced; longer than any map
+    static constexpr float LANE_LENGTH = 1024.0f;
+
+    void beginTick() { ++tick_; }
+    std::int64_t getTick() const { return tick_; }
+
+    // The bullet's lane, or null if it has none yet; marks it seen this tick.
+    // Lane pointers and references stay valid until the next assign() or
+    // dropUnseen()
+    Lane* touch(int bulletId, std::size_t bulletIndex);
+    // Stores a freshly traced lane and queues it for dueTick (none if the
+    // lane has no target)
+    Lane& assign(int bulletId, const Lane& lane, std::int64_t dueTick);
+    void reschedule(int bulletId, std::int64_t dueTick);
+    // Visits lanes due by the current tick; each queue entry is visited once
+    template<typename Visit>
+    void popDue(Visit&& visit);
+    // Forgets bullets not touched this tick
+    void dropUnseen();
+
+    void invalidate(const Rectangle& area);
+    void invalidateAll();
+
+    std::size_t getLaneCount() const { return lanes_.size(); }
+    std::size_t getQueuedCount() const { return queue_.size(); }
+
+private:
+    struct Due {
+        std::int64_t tick;
+        int bulletId;
+        std::uint32_t version;
+        bool operator>(const Due& other) const {
+            if (tick != other.tick) return tick > other.tick;
+            return bulletId > other.bulletId;
+        }
+    };
+
+    FlatHashMap<int, Lane> lanes_;  // Reused as bullets come and go
+    std::priority_queue<Due, std::vector<Due>, std::greater<Due>> queue_;
+    std::int64_t tick_ = 0;
+};
+
+template<typename Visit>
+void BulletLaneSchedule::popDue(Visit&& visit) {
+    while (!queue_.empty() && queue_.top().tick <= tick_) {
+        const Due due = queue_.top();
+        queue_.pop();
+
+        // Entries of replaced, stale or forgotten lanes are skipped here
+        // rather than searched for when the lane changes.
+        Lane* lane = lanes_.find(due.bulletId);
+        if (!lane || lane->version != due.version || lane->stale) {
+            continue;
+        }
+        visit(due.bulletId, *lane);
+    }
+}
+
+} // namespace tank
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "collision/OccupancyBitmap.hpp"
+#include "utils/Rectangle.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief Largest free square at every pixel of an occupancy bitmap
+ *
+ * getClearance(x, y) is the side of the largest square with its top-left
+ * corner at pixel (x, y) that covers no set pixel, capped at
+ * MAX_CLEARANCE. Space outside the map counts as free, as it does for
+ * OccupancyBitmap::any(). Whether a box fits is then decided from the value
+ * at its top-left pixel.
+ *
+ * A pixel's value depends only on pixels below and to the right of it,
+ * within MAX_CLEARANCE. update() therefore recomputes just the block above
+ * and to the left of a change.
+ */
+class ClearanceMap {
+public:
+    // Comfortably above a tank box, which spans at most 31 pixels
+    static constexpr int MAX_CLEARANCE = 48;
+
+    void rebuild(const OccupancyBitmap& blocked);
+    // Call after blocked changed inside area
+    void update(const OccupancyBitmap& blocked, const Rectangle& area);
+
+    int getClearance(int x, int y) const;
+    // Same answer as !blocked.any(box), in O(1) when the clearance at the
+    // box's top-left covers it or falls short of its shorter side; other
+    // boxes fall back to the bitmap.
+    bool isFree(const Rectangle& box, const OccupancyBitmap& blocked) const;
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+
+private:
+    int width_ = 0;
+    int height_ = 0;
+    std::vector<std::uint8_t> clearance_;
+
+    void recompute(const OccupancyBitmap& blocked, int x0, int y0, int x1, int y1);
+};
+
+} // namespace tank
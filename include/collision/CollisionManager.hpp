@@ -2,22 +2,29 @@
 
 #include "collision/ICollisionHandler.hpp"
 #include "entities/base/IEntity.hpp"
+#include <array>
 #include <vector>
 #include <memory>
 #include <functional>
+#include <optional>
 
 namespace tank {
 
 /**
  * @brief Manages collision detection and dispatches to handlers
+ *
+ * Handlers are routed through a kind-by-kind table built as they are added,
+ * so dispatch reads two entity tags instead of asking every handler.
  */
 class CollisionManager {
 public:
     CollisionManager() = default;
     ~CollisionManager() = default;
 
-    // Add a collision handler
+    // Add a collision handler; it is tried after earlier handlers
     void addHandler(std::unique_ptr<ICollisionHandler> handler);
+    // Handlers that may process an a-vs-b collision
+    std::size_t getRouteCount(EntityKind a, EntityKind b) const { return routes_[routeIndex(a, b)].size(); }
 
     // Check collisions between two entity lists
     template<typename ListA, typename ListB>
@@ -26,12 +33,32 @@ public:
     // Check collisions within a single list
     template<typename List>
     void checkCollisionsInternal(List& list);
+    // Same, with overlap(a, b) deciding contact instead of the AABB test
+    template<typename List, typename Overlap>
+    void checkCollisionsInternal(List& list, Overlap&& overlap);
+    // Dispatch index pairs (i, j) already known to touch, in the given
+    // order, skipping entities deactivated by an earlier pair
+    template<typename List, typename Pairs>
+    void resolveContacts(List& list, const Pairs& pairs);
 
     // AABB collision check
     static bool checkAABB(const Rectangle& a, const Rectangle& b);
+    // Earliest fraction t in [0, 1) of delta at which box, moving by delta,
+    // overlaps target (0 if it already does). Touching edges do not count.
+    static std::optional<float> sweepAABB(const Rectangle& box, const Vector2& delta, const Rectangle& target);
 
 private:
+    struct Route {
+        ICollisionHandler* handler;
+        bool swapped;  // Call handle(b, a)
+    };
+
     std::vector<std::unique_ptr<ICollisionHandler>> handlers_;
+    std::array<std::vector<Route>, ENTITY_KIND_COUNT * ENTITY_KIND_COUNT> routes_;
+
+    static std::size_t routeIndex(EntityKind a, EntityKind b) {
+        return static_cast<std::size_t>(a) * ENTITY_KIND_COUNT + static_cast<std::size_t>(b);
+    }
 
     void dispatchCollision(IEntity& a, IEntity& b);
 };
@@ -55,17 +82,32 @@ void CollisionManager::checkCollisions(ListA& listA, ListB& listB) {
 
 template<typename List>
 void CollisionManager::checkCollisionsInternal(List& list) {
+    checkCollisionsInternal(list, [](const auto& a, const auto& b) {
+        return checkAABB(a.getBounds(), b.getBounds());
+    });
+}
+
+template<typename List, typename Overlap>
+void CollisionManager::checkCollisionsInternal(List& list, Overlap&& overlap) {
     for (size_t i = 0; i < list.size(); ++i) {
         if (!list[i]->isActive()) continue;
 
         for (size_t j = i + 1; j < list.size(); ++j) {
             if (!list[j]->isActive()) continue;
 
-            if (checkAABB(list[i]->getBounds(), list[j]->getBounds())) {
+            if (overlap(*list[i], *list[j])) {
                 dispatchCollision(*list[i], *list[j]);
             }
         }
     }
 }
 
+template<typename List, typename Pairs>
+void CollisionManager::resolveContacts(List& list, const Pairs& pairs) {
+    for (const auto& [i, j] : pairs) {
+        if (!list[i]->isActive() || !list[j]->isActive()) continue;
+        dispatchCollision(*list[i], *list[j]);
+    }
+}
+
 } // namespace tank
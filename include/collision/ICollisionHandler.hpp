@@ -12,10 +12,12 @@ class ICollisionHandler {
 public:
     virtual ~ICollisionHandler() = default;
 
-    // Check if this handler can process the collision
-    virtual bool canHandle(IEntity& a, IEntity& b) const = 0;
+    // Check if this handler can process a collision between these kinds.
+    // Queried once per kind pair when the handler is registered.
+    virtual bool canHandle(EntityKind a, EntityKind b) const = 0;
 
-    // Process the collision, return true if collision was handled
+    // Process the collision, return true if collision was handled. Only
+    // called with entities of kinds canHandle() accepted, in that order.
     virtual bool handle(IEntity& a, IEntity& b) = 0;
 };
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "utils/Rectangle.hpp"
+#include "utils/SimdLevel.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace tank {
+
+// Row-test implementation used by OccupancyBitmap::any()
+using OccupancyKernel = SimdLevel;
+
+/**
+ * @brief One bit per pixel marking solid material
+ *
+ * Rows are packed into 64-bit words. A box test masks the (at most four)
+ * words a row span touches and ANDs them row by row, so its cost depends on
+ * the box size only, never on how much terrain the map holds. Rows are
+ * padded so a four-word window never reads past the buffer, which lets the
+ * SSE2/AVX2 kernels use plain unaligned loads.
+ *
+ * Pixel p is covered by a rectangle when [p, p+1) overlaps it, so tests
+ * against pixel-aligned solids agree with Rectangle::intersects.
+ */
+class OccupancyBitmap {
+public:
+    explicit OccupancyBitmap(int width = 0, int height = 0);
+
+    // Resizes to width x height pixels, all clear
+    void reset(int width, int height);
+    void clear();
+
+    void fill(const Rectangle& area);
+    void erase(const Rectangle& area);
+
+    // True if any pixel under area is set
+    bool any(const Rectangle& area) const;
+    bool test(int x, int y) const;
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+
+    // Kernel picked at startup from the CPU's features; tests and benchmarks
+    // can force another one. Returns false if the CPU cannot run it. Safe
+    // while contact workers query; a query in flight keeps its kernel.
+    static OccupancyKernel getKernel();
+    static bool setKernel(OccupancyKernel kernel);
+    static const char* getKernelName(OccupancyKernel kernel);
+
+private:
+    static constexpr int WORD_BITS = 64;
+    static constexpr int WINDOW_WORDS = 4;
+
+    struct PixelSpan {
+        int x0;
+        int y0;
+        int x1;  // Exclusive
+        int y1;
+        bool empty() const { return x1 <= x0 || y1 <= y0; }
+    };
+
+    int width_ = 0;
+    int height_ = 0;
+    int stride_ = 0;  // Words per row, including padding
+    std::vector<std::uint64_t> words_;
+
+    PixelSpan spanFor(const Rectangle& area) const;
+    void assign(const Rectangle& area, bool solid);
+};
+
+} // namespace tank
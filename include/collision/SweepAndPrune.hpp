@@ -0,0 +1,79 @@
+#pragma once
+
+#include "collision/BoxBatch.hpp"
+#include "utils/Constants.hpp"
+#include "utils/FlatHashMap.hpp"
+#include "utils/Rectangle.hpp"
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief Incremental sort-and-sweep broadphase for moving entities
+ *
+ * Proxies persist between frames, keyed by the caller, and stay sorted by
+ * their left edge. Entities move little from one tick to the next, so the
+ * insertion sort that restores the order is close to linear. The sweep then
+ * only pairs proxies whose x intervals overlap and tests y for those,
+ * batched through BoxBatch.
+ *
+ * Usage per tick: beginFrame(), submit() every live entity, findPairs().
+ * Proxies not submitted in a frame are dropped.
+ */
+class SweepAndPrune {
+public:
+    // Candidate pair, ordered so kindA <= kindB (and indexA < indexB for
+    // equal kinds). Indices are whatever the caller passed to submit().
+    struct Pair {
+        EntityKind kindA;
+        int indexA;
+        EntityKind kindB;
+        int indexB;
+    };
+
+    SweepAndPrune();
+
+    // Only pairs of enabled kind combinations are reported (all by default)
+    void setPairFilter(EntityKind a, EntityKind b, bool enabled);
+
+    void beginFrame();
+    // key must be unique among live proxies; see makeKey()
+    void submit(std::uint64_t key, EntityKind kind, int index, const Rectangle& bounds);
+    // Replaces out with this frame's overlapping pairs, sorted by
+    // (kindA, indexA, kindB, indexB) so callers see a stable order.
+    void findPairs(std::vector<Pair>& out);
+
+    std::size_t getProxyCount() const { return order_.size(); }
+    // Order swaps made by the last findPairs(); low when motion is coherent
+    std::size_t getLastSwapCount() const { return lastSwapCount_; }
+
+    static std::uint64_t makeKey(EntityKind kind, int id) {
+        return (static_cast<std::uint64_t>(kind) << 32) | static_cast<std::uint32_t>(id);
+    }
+
+private:
+    struct Proxy {
+        std::uint64_t key;
+        EntityKind kind;
+        int index;
+        Rectangle bounds;
+        std::uint32_t frame;
+    };
+
+    std::vector<Proxy> proxies_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::vector<std::uint32_t> order_;  // Proxy slots sorted by left edge
+    FlatHashMap<std::uint64_t, std::uint32_t> slotByKey_;
+    BoxBatch sorted_;                   // Bounds in order_, rebuilt per findPairs()
+    std::bitset<ENTITY_KIND_COUNT * ENTITY_KIND_COUNT> pairFilter_;
+    std::uint32_t frame_ = 0;
+    std::size_t lastSwapCount_ = 0;
+
+    void dropStaleProxies();
+    void sortByLeftEdge();
+};
+
+} // namespace tank
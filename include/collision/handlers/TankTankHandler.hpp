@@ -12,7 +12,7 @@ namespace tank {
  */
 class TankTankHandler : public ICollisionHandler {
 public:
-    bool canHandle(IEntity& a, IEntity& b) const override;
+    bool canHandle(EntityKind a, EntityKind b) const override;
     bool handle(IEntity& a, IEntity& b) override;
 
 private:
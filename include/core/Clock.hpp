@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+
+namespace tank {
+
+/**
+ * @brief Source of wall-clock time for the main loop
+ *
+ * The loop and the frame pacer read time and wait only through this, so tests
+ * and tools can substitute a ManualClock and step time deterministically.
+ */
+class IClock {
+public:
+    virtual ~IClock() = default;
+
+    // Seconds since an arbitrary origin (monotonic)
+    virtual double now() const = 0;
+    // Coarse wait; may return early or late by the OS sleep granularity
+    virtual void sleepFor(double seconds) = 0;
+    // Precise wait: returns once now() >= deadline
+    virtual void spinUntil(double deadline) = 0;
+};
+
+/**
+ * @brief Real time from std::chrono::steady_clock
+ */
+class SystemClock : public IClock {
+public:
+    SystemClock();
+
+    double now() const override;
+    void sleepFor(double seconds) override;
+    void spinUntil(double deadline) override;
+
+private:
+    std::chrono::steady_clock::time_point origin_;
+};
+
+/**
+ * @brief Time that only moves when told to; waits advance it instantly
+ */
+class ManualClock : public IClock {
+public:
+    explicit ManualClock(double start = 0.0) : now_(start) {}
+
+    double now() const override { return now_; }
+    void sleepFor(double seconds) override { advance(seconds); }
+    void spinUntil(double deadline) override {
+        if (deadline > now_) {
+            now_ = deadline;
+        }
+    }
+
+    void advance(double seconds) {
+        if (seconds > 0.0) {
+            now_ += seconds;
+        }
+    }
+
+private:
+    double now_;
+};
+
+} // namespace tank
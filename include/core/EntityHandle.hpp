@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tank {
+
+class IEntity;
+
+/**
+ * @brief Weak reference to an entity: a table slot plus the generation the
+ * slot had when the entity took it
+ *
+ * The default handle is null and never valid. Handles compare and copy like
+ * integers, so they can key side tables and be written out as they are.
+ */
+struct EntityHandle {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;  // 0 only for the null handle
+
+    bool isNull() const { return generation == 0; }
+    bool operator==(const EntityHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Slot table that hands out generational entity handles
+ *
+ * Every entity takes a slot when it is constructed and gives it back when it
+ * is destroyed, which bumps the slot's generation. A handle to a destroyed
+ * entity therefore resolves to null in O(1), without anyone having to find
+ * and clear the references to it. Freed slots are reused, so the table only
+ * grows to the peak number of live entities. Each EntityWorld owns one.
+ */
+class EntityHandleTable {
+public:
+    EntityHandle create(IEntity* entity);
+    void destroy(EntityHandle handle);
+
+    // The entity, or null if the handle is null or its entity is gone
+    IEntity* get(EntityHandle handle) const;
+    bool isValid(EntityHandle handle) const { return get(handle) != nullptr; }
+
+    std::size_t getLiveCount() const { return liveCount_; }
+
+private:
+    struct Slot {
+        IEntity* entity = nullptr;
+        std::uint32_t generation = 1;
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::size_t liveCount_ = 0;
+};
+
+} // namespace tank
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "core/EntityHandle.hpp"
+#include "core/ObjectPool.hpp"
+#include "entities/projectiles/BulletStore.hpp"
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace tank {
+
+/**
+ * @brief Bookkeeping a game world shares with the entities it creates
+ *
+ * PlayingState owns one (tests and tools make their own) and passes it to
+ * every entity constructor, so worlds running side by side never share
+ * handle slots, bullet storage or allocation pools. A world is
+ * single-threaded outside the contact phase, which only reads it, so
+ * nothing here locks.
+ */
+class EntityWorld {
+public:
+    EntityWorld();
+
+    EntityWorld(const EntityWorld&) = delete;
+    EntityWorld& operator=(const EntityWorld&) = delete;
+
+    // Builds T(*this, args...) in the world's pool for T (bullets, effects,
+    // power-ups); the object goes back to that pool when it is deleted
+    template<typename T, typename... Args>
+    std::unique_ptr<T> create(Args&&... args);
+
+    EntityHandleTable& getHandles() { return handles_; }
+    const EntityHandleTable& getHandles() const { return handles_; }
+
+    // Motion state of every bullet of this world
+    BulletStore& getBulletStore() { return bullets_; }
+    const BulletStore& getBulletStore() const { return bullets_; }
+
+    ObjectPool& getBulletPool() { return bulletPool_; }
+    ObjectPool& getEffectPool() { return effectPool_; }
+    ObjectPool& getPowerUpPool() { return powerUpPool_; }
+
+private:
+    EntityHandleTable handles_;
+    BulletStore bullets_;
+    ObjectPool bulletPool_;
+    ObjectPool effectPool_;
+    ObjectPool powerUpPool_;
+};
+
+template<typename T, typename... Args>
+std::unique_ptr<T> EntityWorld::create(Args&&... args) {
+    void* memory = T::getPool(*this).acquire(sizeof(T));
+    try {
+        return std::unique_ptr<T>(::new (memory) T(*this, std::forward<Args>(args)...));
+    } catch (...) {
+        ObjectPool::release(memory);
+        throw;
+    }
+}
+
+} // namespace tank
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief Bump allocator for scratch data that lives for one tick
+ *
+ * allocate() hands out memory from large blocks and deallocate() only
+ * returns the most recent allocation, so a growing vector can reuse its
+ * own tail. Everything is released at once by reset(). When a tick needed
+ * more than one block, reset() replaces them with a single block of their
+ * combined size, so after the first few ticks the arena stops touching the
+ * heap.
+ */
+class FrameArena {
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit FrameArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    void deallocate(void* pointer, std::size_t bytes);
+    // Invalidates everything allocated since the last reset
+    void reset();
+
+    std::size_t getBytesUsed() const;
+    std::size_t getCapacity() const;
+    std::size_t getBlockCount() const { return blocks_.size(); }
+
+private:
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size = 0;
+    };
+
+    std::vector<Block> blocks_;
+    std::size_t blockSize_;
+    std::size_t current_ = 0;  // Block being filled
+    std::size_t offset_ = 0;   // Bytes used in it
+    std::size_t previousBlocksUsed_ = 0;
+
+    void addBlock(std::size_t size);
+};
+
+/**
+ * @brief Standard allocator drawing from a FrameArena
+ */
+template<typename T>
+class FrameAllocator {
+public:
+    using value_type = T;
+
+    explicit FrameAllocator(FrameArena& arena) noexcept : arena_(&arena) {}
+    template<typename U>
+    FrameAllocator(const FrameAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* pointer, std::size_t count) noexcept {
+        arena_->deallocate(pointer, count * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(const FrameAllocator<U>& other) const noexcept { return arena_ == other.arena_; }
+    template<typename U>
+    bool operator!=(const FrameAllocator<U>& other) const noexcept { return arena_ != other.arena_; }
+
+private:
+    template<typename> friend class FrameAllocator;
+    FrameArena* arena_;
+};
+
+// Vector whose storage comes from a FrameArena; must not outlive its reset()
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // namespace tank
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "core/Clock.hpp"
+#include "utils/Constants.hpp"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace tank {
+
+/**
+ * @brief How the main loop waits between frames
+ */
+enum class PacingMode {
+    VSync,      // Present blocks on the display; no extra wait
+    Limiter,    // Sleep most of the remaining frame, then spin to the deadline
+    Uncapped    // Never wait (benchmarking)
+};
+
+/**
+ * @brief Rolling window of latency samples with percentile queries
+ */
+class LatencyTracker {
+public:
+    static constexpr size_t CAPACITY = 240;  // ~4 s at 60 Hz
+
+    void addSample(double seconds);
+    void reset();
+
+    size_t getSampleCount() const { return count_; }
+    double getLatest() const { return latest_; }
+    double getAverage() const;
+    double getMax() const;
+    // percentile in [0, 100] over the samples currently in the window
+    double getPercentile(double percentile) const;
+
+private:
+    std::array<double, CAPACITY> samples_{};
+    size_t next_ = 0;
+    size_t count_ = 0;
+    double latest_ = 0.0;
+};
+
+/**
+ * @brief Paces the main loop with a high-resolution clock
+ *
+ * Time comes from an IClock (a SystemClock unless one is injected).
+ * Also measures, per frame, the time from sampling input to the return of
+ * present() - the part of input-to-photon latency the game controls.
+ * Limiter deadlines advance by whole periods from the previous deadline, so
+ * rounding never accumulates into drift.
+ */
+class FramePacer {
+public:
+    explicit FramePacer(PacingMode mode = PacingMode::VSync, double targetFps = Constants::TARGET_FPS,
+                        std::shared_ptr<IClock> clock = nullptr);
+
+    // Replaces the time source; null restores a SystemClock.
+    void setClock(std::shared_ptr<IClock> clock);
+    IClock& getClock() const { return *clock_; }
+
+    void setMode(PacingMode mode) { mode_ = mode; }
+    PacingMode getMode() const { return mode_; }
+    void setTargetFps(double fps);
+    double getTargetFps() const { return targetFps_; }
+
+    // Seconds on the pacer's clock (high resolution, monotonic)
+    double now() const { return clock_->now(); }
+
+    // Frame markers, called in this order by the main loop
+    void markInputSampled();
+    void markPresented();
+    // Blocks until the next frame should start (Limiter only).
+    void waitForNextFrame();
+
+    const LatencyTracker& getInputLatency() const { return inputLatency_; }
+    const LatencyTracker& getFrameTimes() const { return frameTimes_; }
+
+    static const char* modeName(PacingMode mode);
+    static bool parseMode(const std::string& text, PacingMode& mode);
+
+private:
+    // Below this much remaining time the limiter spins instead of sleeping;
+    // OS sleep granularity is typically 1-2 ms.
+    static constexpr double SPIN_THRESHOLD_SECONDS = 0.002;
+
+    PacingMode mode_;
+    double targetFps_ = Constants::TARGET_FPS;
+    double periodSeconds_ = 1.0 / Constants::TARGET_FPS;
+
+    std::shared_ptr<IClock> clock_;
+    double nextDeadline_ = 0.0;
+    double inputSampledAt_ = -1.0;
+    double lastPresentAt_ = -1.0;
+
+    LatencyTracker inputLatency_;
+    LatencyTracker frameTimes_;
+};
+
+} // namespace tank
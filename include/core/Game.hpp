@@ -1,9 +1,13 @@
 #pragma once
 
 #include "states/GameStateManager.hpp"
+#include "rendering/RecordingRenderer.hpp"
+#include "rendering/RenderThread.hpp"
 #include "rendering/SDLRenderer.hpp"
 #include "input/InputManager.hpp"
 #include "audio/SDLAudioPlayer.hpp"
+#include "core/FramePacer.hpp"
+#include "core/SimulationTimer.hpp"
 #include "utils/Constants.hpp"
 #include <memory>
 #include <string>
@@ -23,6 +27,20 @@ public:
     Game(const Game&) = delete;
     Game& operator=(const Game&) = delete;
 
+    // Frame pacing strategy (call before initialize)
+    void setPacing(PacingMode mode, double targetFps = Constants::TARGET_FPS);
+    const FramePacer& getFramePacer() const { return framePacer_; }
+
+    // Time source for the loop (tests/tools may inject a ManualClock)
+    void setClock(std::shared_ptr<IClock> clock);
+    // Simulation speed: < 1 is slow motion, up to 16x fast-forward
+    void setTimeScale(double scale) { simTimer_.setTimeScale(scale); }
+    double getTimeScale() const { return simTimer_.getTimeScale(); }
+
+    // Submit frames from a dedicated render thread (call before initialize)
+    void setRenderThreadEnabled(bool enabled) { renderThreadEnabled_ = enabled; }
+    bool isRenderThreadEnabled() const { return renderThreadEnabled_; }
+
     // Initialization
     bool initialize();
     void shutdown();
@@ -42,18 +60,34 @@ private:
 
     // Core systems
     std::shared_ptr<SDLRenderer> renderer_;
+    // With the render thread, states draw into recorder_ and renderer_ is
+    // only driven from renderThread_.
+    std::shared_ptr<RecordingRenderer> recorder_;
+    std::unique_ptr<RenderThread> renderThread_;
+#if defined(__APPLE__)
+    bool renderThreadEnabled_ = false;  // Cocoa wants all rendering on the main thread
+#else
+    bool renderThreadEnabled_ = true;
+#endif
     std::shared_ptr<InputManager> inputManager_;
     std::shared_ptr<SDLAudioPlayer> audioPlayer_;
     GameStateManager stateManager_;
 
     // Timing
-    uint32_t previousTime_ = 0;
-    float accumulator_ = 0.0f;
+    FramePacer framePacer_;
+    SimulationTimer simTimer_;
+    double previousTime_ = 0.0;
+    bool showLatency_ = false;  // F3 toggles the latency readout
 
     // Game loop methods
-    void processInput();
+    void processInput();                   // Poll and queue this frame's events
+    void processTickInput(uint32_t tickTime);  // Apply the events that precede a tick
     void update(float deltaTime);
     void render();
+    IRenderer& frameRenderer();  // Where this frame's draw calls go
+    void waitForActivity(float idleInterval);  // Power-saving sleep in the event queue
+    void renderLatencyOverlay();
+    void reportLatency() const;
 
     // Initialize subsystems
     bool initializeRenderer();
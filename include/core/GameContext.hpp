@@ -0,0 +1,60 @@
+#pragma once
+
+#include "rendering/IRenderer.hpp"
+#include "input/IInput.hpp"
+#include "audio/IAudioPlayer.hpp"
+#include <memory>
+#include <string>
+
+namespace tank {
+
+/**
+ * @brief Services available to one game world
+ *
+ * Owned by GameStateManager and handed to its states, so several worlds can
+ * live in one process (e.g. headless simulations on worker threads), each
+ * with its own services or none at all. Every service is optional; a world
+ * without audio simply stays silent.
+ * (DIP - states depend on the interfaces, not on concrete SDL backends)
+ */
+class GameContext {
+public:
+    GameContext() = default;
+    GameContext(std::shared_ptr<IRenderer> renderer,
+                std::shared_ptr<IInput> input,
+                std::shared_ptr<IAudioPlayer> audio)
+        : renderer_(std::move(renderer))
+        , input_(std::move(input))
+        , audio_(std::move(audio))
+    {
+    }
+
+    bool hasRenderer() const { return renderer_ != nullptr; }
+    bool hasInput() const { return input_ != nullptr; }
+    bool hasAudio() const { return audio_ != nullptr; }
+
+    // Null when the service was not provided.
+    IRenderer* getRenderer() const { return renderer_.get(); }
+    IInput* getInput() const { return input_.get(); }
+    IAudioPlayer* getAudio() const { return audio_.get(); }
+
+    // Audio helpers that are no-ops without an audio service
+    void playSound(SoundId id) const {
+        if (audio_) {
+            audio_->playSound(id);
+        }
+    }
+
+    void playMusic(const std::string& path, bool loop = true) const {
+        if (audio_) {
+            audio_->playMusic(path, loop);
+        }
+    }
+
+private:
+    std::shared_ptr<IRenderer> renderer_;
+    std::shared_ptr<IInput> input_;
+    std::shared_ptr<IAudioPlayer> audio_;
+};
+
+} // namespace tank
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace tank {
+
+/**
+ * @brief Command-line options for a headless simulation run
+ */
+struct HeadlessOptions {
+    int level = 1;
+    int ticks = 60 * 60 * 5;   // Upper bound; the run stops early once the match is decided
+    std::uint32_t seed = 1;
+    bool twoPlayer = false;
+};
+
+enum class HeadlessOutcome {
+    Running,    // Tick budget exhausted before the match was decided
+    Victory,
+    Defeat,
+    LevelLoadFailed  // The level file was missing or unreadable; nothing ran
+};
+
+struct HeadlessSummary {
+    int ticks = 0;
+    double simulatedSeconds = 0.0;
+    double wallSeconds = 0.0;
+    double ticksPerSecond = 0.0;
+    HeadlessOutcome outcome = HeadlessOutcome::Running;
+    int player1Score = 0;
+    int player2Score = 0;
+};
+
+/**
+ * @brief Runs one match without a window, renderer, input device or mixer
+ *
+ * Drives GameStateManager/PlayingState with Constants::FIXED_DELTA_TIME as
+ * fast as the CPU allows. Players receive no input, so the match exercises
+ * enemy AI, collisions and power-up drops; a fixed seed makes it repeatable.
+ * The requested level must load: there is no fallback to a blank map.
+ */
+class HeadlessRunner {
+public:
+    explicit HeadlessRunner(const HeadlessOptions& options);
+
+    HeadlessSummary run();
+
+    // Parses argv, runs the match and prints the summary to stdout.
+    // Returns a process exit code, nonzero if the level failed to load.
+    static int runFromCommandLine(int argc, char* argv[]);
+
+    // True if argv asks for headless mode (--headless).
+    static bool isRequested(int argc, char* argv[]);
+    // Parses --level N --ticks T --seed S --players 1|2. Returns false and
+    // fills error on malformed input.
+    static bool parseArguments(int argc, char* argv[], HeadlessOptions& options, std::string& error);
+    static const char* outcomeName(HeadlessOutcome outcome);
+    static void printSummary(const HeadlessSummary& summary, std::ostream& out);
+
+private:
+    HeadlessOptions options_;
+};
+
+} // namespace tank
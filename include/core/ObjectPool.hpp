@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace tank {
+
+/**
+ * @brief Fixed number of equally sized slots recycled through a free list
+ *
+ * Backs the short-lived entities (bullets, effects, power-ups) that
+ * EntityWorld::create() builds; every world owns its own pools. Each block
+ * starts after a small header naming the pool it came from, so the classes'
+ * operator delete returns it through release() without knowing the world.
+ * acquire() and release() are O(1) and slots never move. A request that does
+ * not fit (pool full, or larger than a slot) falls back to the global heap
+ * and is counted in getOverflowCount().
+ *
+ * Not thread-safe: a world creates and destroys its entities on one thread,
+ * and debug builds assert that a pool stays on the thread that built it.
+ */
+class ObjectPool {
+public:
+    ObjectPool(std::size_t slotSize, std::size_t capacity);
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    void* acquire(std::size_t size);
+    // Frees a block from acquire() or allocateUnpooled(), whichever pool
+    // (or the heap) it came from
+    static void release(void* pointer);
+    // Heap block release() accepts; plain new of a pooled class uses it
+    static void* allocateUnpooled(std::size_t size);
+
+    bool owns(const void* pointer) const;
+    std::size_t getCapacity() const { return capacity_; }
+    std::size_t getSlotSize() const { return slotSize_; }
+    std::size_t getInUse() const { return inUse_; }
+    std::size_t getOverflowCount() const { return overflowCount_; }
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+    // Keeps the block after it aligned for any ordinary type
+    struct alignas(std::max_align_t) Header {
+        ObjectPool* pool;  // Null for heap blocks
+    };
+
+    std::size_t slotSize_;
+    std::size_t capacity_;
+    std::unique_ptr<unsigned char[]> storage_;  // capacity_ x (Header + slot)
+    FreeSlot* freeList_ = nullptr;
+    std::size_t inUse_ = 0;
+    std::size_t overflowCount_ = 0;
+    std::thread::id owner_;
+
+    std::size_t getStride() const { return sizeof(Header) + slotSize_; }
+    void releaseSlot(Header* header);
+};
+
+} // namespace tank
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "utils/Constants.hpp"
+
+namespace tank {
+
+/**
+ * @brief Fixed-step accumulator with a time scale
+ *
+ * Real frame time is clamped (so a hitch cannot start a spiral of death),
+ * multiplied by the time scale and accumulated; every whole step is one
+ * simulation tick. At 16x a frame runs many ticks and only the last is
+ * rendered. The simulated/real ratio actually achieved is measured over
+ * roughly one-second windows, so it shows where tick cost caps the speed-up.
+ */
+class SimulationTimer {
+public:
+    static constexpr double MIN_TIME_SCALE = 0.125;
+    static constexpr double MAX_TIME_SCALE = 16.0;
+    static constexpr double MAX_FRAME_TIME = 0.25;  // Real seconds per frame
+
+    explicit SimulationTimer(double step = Constants::FIXED_DELTA_TIME) : step_(step) {}
+
+    void setTimeScale(double scale);
+    double getTimeScale() const { return timeScale_; }
+
+    // Adds a frame's real elapsed time.
+    void advance(double realSeconds);
+    // True while a whole step is accumulated; consumeTick() takes it.
+    bool hasTick() const { return accumulator_ >= step_; }
+    void consumeTick();
+
+    double getStep() const { return step_; }
+    // Fraction of a step accumulated towards the next tick, for interpolation
+    float getAlpha() const { return static_cast<float>(accumulator_ / step_); }
+    // Real time the simulation trails "now" by, and real time until the next
+    // tick is due, both at the current scale.
+    double getRealSecondsBehind() const { return accumulator_ / timeScale_; }
+    double getRealSecondsUntilNextTick() const;
+
+    // Simulated seconds per real second over the last complete window
+    double getEffectiveScale() const { return effectiveScale_; }
+
+    // Hotkey helpers: 1x -> 2x -> 4x -> 16x -> 1x, and 1x <-> 0.25x
+    static double nextTurboScale(double scale);
+    static double toggleSlowMotion(double scale);
+
+private:
+    static constexpr double MEASURE_WINDOW = 1.0;
+
+    double step_;
+    double timeScale_ = 1.0;
+    double accumulator_ = 0.0;
+
+    double windowReal_ = 0.0;
+    double windowSimulated_ = 0.0;
+    double effectiveScale_ = 1.0;
+};
+
+} // namespace tank
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief Fixed set of worker threads for data-parallel loops
+ *
+ * parallelFor() splits an index range into one contiguous chunk per lane
+ * (the calling thread is lane 0) and returns once every chunk is done.
+ * Chunk boundaries depend only on the count and lane count, so a caller
+ * that writes lane-local output and concatenates it in lane order gets the
+ * same result as a serial loop.
+ */
+class WorkerPool {
+public:
+    using Task = std::function<void(std::size_t lane, std::size_t begin, std::size_t end)>;
+
+    // workerCount threads in addition to the caller; 0 runs everything inline
+    explicit WorkerPool(std::size_t workerCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    std::size_t getLaneCount() const { return workers_.size() + 1; }
+    void parallelFor(std::size_t count, const Task& task);
+
+    // Hardware threads minus the caller, capped at maxWorkers
+    static std::size_t defaultWorkerCount(std::size_t maxWorkers);
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable workReady_;
+    std::condition_variable workDone_;
+    const Task* task_ = nullptr;
+    std::size_t count_ = 0;
+    std::uint64_t generation_ = 0;
+    std::size_t running_ = 0;
+    bool stopping_ = false;
+
+    void run(std::size_t lane);
+    void runChunk(const Task& task, std::size_t lane, std::size_t count) const;
+};
+
+} // namespace tank
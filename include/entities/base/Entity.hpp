@@ -9,23 +9,34 @@
 
 namespace tank {
 
+class EntityWorld;
+
 /**
  * @brief Base entity class implementing common functionality
  * Template Method Pattern: defines skeleton of algorithms
  */
 class Entity : public IEntity, public IRenderable {
 public:
-    Entity(const Vector2& position, float width, float height);
-    ~Entity() override = default;
+    Entity(EntityWorld& world, const Vector2& position, float width, float height);
+    ~Entity() override;
+
+    // Registered under one handle for life
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
 
     // IEntity implementation
     int getId() const override { return id_; }
+    EntityHandle getHandle() const override { return handle_; }
+    EntityKind getKind() const override { return kind_; }
+    Team getTeam() const override { return team_; }
 
     Vector2 getPosition() const override { return position_; }
     void setPosition(const Vector2& pos) override { position_ = pos; }
 
+    // Read through getPosition(), so a subclass keeping its position
+    // elsewhere (Bullet) only overrides that pair
     Rectangle getBounds() const override {
-        return Rectangle(position_.x, position_.y, width_, height_);
+        return Rectangle(getPosition(), width_, height_);
     }
 
     bool isActive() const override { return active_; }
@@ -37,6 +48,15 @@ public:
     void render(IRenderer& renderer) override;
     RenderLayer getRenderLayer() const override { return renderLayer_; }
 
+    // Render interpolation: the loop draws between the position at the start
+    // of the current tick and position_, weighted by its leftover alpha.
+    void snapshotTransform() { tickStartPosition_ = getPosition(); }
+    void setRenderAlpha(float alpha) { renderAlpha_ = alpha; }
+    Vector2 getRenderPosition() const {
+        return Vector2::interpolate(tickStartPosition_, getPosition(), renderAlpha_,
+                                    Constants::MAX_INTERPOLATION_DISTANCE);
+    }
+
     // Dimensions
     float getWidth() const { return width_; }
     float getHeight() const { return height_; }
@@ -47,8 +67,14 @@ protected:
     virtual void onUpdate(float deltaTime) {}
     virtual void onRender(IRenderer& renderer) {}
 
+    EntityWorld& world_;
     int id_;
+    EntityHandle handle_;
+    EntityKind kind_ = EntityKind::Unknown;
+    Team team_ = Team::Neutral;
     Vector2 position_;
+    Vector2 tickStartPosition_;
+    float renderAlpha_ = 1.0f;
     float width_;
     float height_;
     bool active_ = true;
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "core/EntityHandle.hpp"
 #include "utils/Vector2.hpp"
 #include "utils/Rectangle.hpp"
+#include "utils/Constants.hpp"
 
 namespace tank {
 
@@ -14,6 +16,10 @@ public:
 
     // Identity
     virtual int getId() const = 0;
+    // Weak reference that resolves to null once the entity is destroyed
+    virtual EntityHandle getHandle() const = 0;
+    virtual EntityKind getKind() const = 0;
+    virtual Team getTeam() const = 0;
 
     // Position
     virtual Vector2 getPosition() const = 0;
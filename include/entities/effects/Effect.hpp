@@ -1,6 +1,7 @@
 #pragma once
 
 #include "entities/base/Entity.hpp"
+#include "core/ObjectPool.hpp"
 #include "graphics/Animation.hpp"
 #include "utils/Constants.hpp"
 
@@ -22,9 +23,16 @@ enum class EffectType {
  */
 class Effect : public Entity {
 public:
-    Effect(int x, int y, EffectType type);
+    Effect(EntityWorld& world, int x, int y, EffectType type);
     ~Effect() override = default;
 
+    // Every effect type shares one pool per world, each slot large enough
+    // for the biggest type; see EntityWorld::create()
+    static void* operator new(std::size_t size);
+    static void operator delete(void* pointer);
+    static ObjectPool& getPool(EntityWorld& world);
+    static constexpr std::size_t POOL_CAPACITY = 512;
+
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
 
@@ -49,7 +57,7 @@ protected:
  */
 class SpawnEffect : public Effect {
 public:
-    SpawnEffect(int x, int y);
+    SpawnEffect(EntityWorld& world, int x, int y);
     void render(IRenderer& renderer) override;
 
 protected:
@@ -65,7 +73,7 @@ private:
  */
 class BulletExplosion : public Effect {
 public:
-    BulletExplosion(int x, int y);
+    BulletExplosion(EntityWorld& world, int x, int y);
     void render(IRenderer& renderer) override;
 
 protected:
@@ -81,7 +89,7 @@ private:
  */
 class TankExplosion : public Effect {
 public:
-    TankExplosion(int x, int y);
+    TankExplosion(EntityWorld& world, int x, int y);
     void render(IRenderer& renderer) override;
 
 protected:
@@ -97,7 +105,7 @@ private:
  */
 class InvincibilityEffect : public Effect {
 public:
-    InvincibilityEffect(int x, int y, float duration);
+    InvincibilityEffect(EntityWorld& world, int x, int y, float duration);
 
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
@@ -121,7 +129,7 @@ private:
  */
 class ScorePopup : public Effect {
 public:
-    ScorePopup(int x, int y, int points, int multiplier = 1);
+    ScorePopup(EntityWorld& world, int x, int y, int points, int multiplier = 1);
 
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
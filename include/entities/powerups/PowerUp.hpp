@@ -1,6 +1,7 @@
 #pragma once
 
 #include "entities/base/Entity.hpp"
+#include "core/ObjectPool.hpp"
 #include "graphics/Animation.hpp"
 #include "utils/Constants.hpp"
 
@@ -12,9 +13,15 @@ namespace tank {
  */
 class PowerUp : public Entity {
 public:
-    PowerUp(int x, int y, PowerUpType type);
+    PowerUp(EntityWorld& world, int x, int y, PowerUpType type);
     ~PowerUp() override = default;
 
+    // EntityWorld::create() takes a slot of the world's power-up pool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* pointer);
+    static ObjectPool& getPool(EntityWorld& world);
+    static constexpr std::size_t POOL_CAPACITY = 32;
+
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
 
@@ -7,6 +7,7 @@
 
 namespace tank {
 
+class EntityWorld;
 class IRenderer;
 class PlayerTank;
 
@@ -15,7 +16,7 @@ class PlayerTank;
  */
 class PowerUpManager {
 public:
-    PowerUpManager() = default;
+    explicit PowerUpManager(EntityWorld& world) : world_(world) {}
     ~PowerUpManager() = default;
 
     void clear();
@@ -29,8 +30,10 @@ public:
     std::optional<PowerUpType> tryCollect(PlayerTank& player);
 
     size_t getCount() const { return powerUps_.size(); }
+    const std::vector<std::unique_ptr<PowerUp>>& getPowerUps() const { return powerUps_; }
 
 private:
+    EntityWorld& world_;
     std::vector<std::unique_ptr<PowerUp>> powerUps_;
 
     void removeInactive();
@@ -2,7 +2,10 @@
 
 #include "entities/base/Entity.hpp"
 #include "entities/base/IMovable.hpp"
+#include "core/ObjectPool.hpp"
+#include "entities/projectiles/BulletStore.hpp"
 #include "utils/Constants.hpp"
+#include <cstdint>
 
 namespace tank {
 
@@ -10,30 +13,58 @@ class ITank;
 
 /**
  * @brief Bullet projectile entity
+ *
+ * Motion state lives in a BulletStore slot (see BulletStore); the object
+ * holds the owner handle and combat stats.
  */
 class Bullet : public Entity, public IMovable {
 public:
-    Bullet(const Vector2& position, Direction direction, ITank* owner, int level = 0);
-    ~Bullet() override = default;
+    // Takes a slot in the world's bullet store
+    Bullet(EntityWorld& world, const Vector2& position, Direction direction, ITank* owner, int level = 0);
+    ~Bullet() override;
+
+    // EntityWorld::create() takes a slot of the world's bullet pool; plain
+    // new goes to the heap
+    static void* operator new(std::size_t size);
+    static void operator delete(void* pointer);
+    static ObjectPool& getPool(EntityWorld& world);
+    static constexpr std::size_t POOL_CAPACITY = 1024;
+
+    // Bound to a store slot
+    Bullet(const Bullet&) = delete;
+    Bullet& operator=(const Bullet&) = delete;
+
+    // Position comes from the store, not Entity::position_; Entity reads it
+    // through these, bounds and render interpolation included
+    Vector2 getPosition() const override { return store_->positions_[slot_]; }
+    void setPosition(const Vector2& pos) override { store_->positions_[slot_] = pos; }
+    bool isActive() const override { return active_; }
+    void setActive(bool active) override;
 
     // IMovable implementation
     void move(Direction direction) override;
-    float getSpeed() const override { return speed_; }
-    void setSpeed(float speed) override { speed_ = speed; }
-    Direction getDirection() const override { return direction_; }
-    void setDirection(Direction dir) override { direction_ = dir; }
+    float getSpeed() const override { return store_->speeds_[slot_]; }
+    void setSpeed(float speed) override { store_->speeds_[slot_] = speed; }
+    Direction getDirection() const override { return store_->directions_[slot_]; }
+    void setDirection(Direction dir) override { store_->directions_[slot_] = dir; }
 
     // Bullet specific
-    ITank* getOwner() const { return owner_; }
+    // The shooter, or null once it is destroyed or detached
+    ITank* getOwner() const;
+    EntityHandle getOwnerHandle() const { return owner_; }
+    // This tick's travel: the bounds it started from and the offset moved.
+    // Collision traces this segment so fast bullets cannot skip targets.
+    Rectangle getSegmentStartBounds() const { return Rectangle(store_->segmentStarts_[slot_], width_, height_); }
+    Vector2 getSegmentDelta() const { return getPosition() - store_->segmentStarts_[slot_]; }
     int getAttack() const { return attack_; }
     int getLevel() const { return level_; }
 
-    void hit() { hitTarget_ = true; }
+    void hit();
     bool hasHitTarget() const { return hitTarget_; }
 
     void die();
     void clearOwner();
-    bool isAlive() const { return !hitTarget_ && active_; }
+    bool isAlive() const { return store_->alive_[slot_] != 0; }
 
     // Check if bullet is out of bounds
     bool isOutOfBounds() const;
@@ -45,9 +76,13 @@ protected:
     void onRender(IRenderer& renderer) override;
 
 private:
-    ITank* owner_;
-    Direction direction_;
-    float speed_;
+    friend class BulletStore;
+
+    BulletStore* store_;
+    std::uint32_t slot_;
+
+    void init(const Vector2& position, Direction direction, ITank* owner);
+    EntityHandle owner_;  // Always a tank
     int attack_;
     int level_;
     bool hitTarget_ = false;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "utils/Constants.hpp"
+#include "utils/Vector2.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tank {
+
+class Bullet;
+
+/**
+ * @brief Per-field arrays holding the motion state of bullets
+ *
+ * A bullet's position, segment start, direction, speed and alive flag live
+ * in one slot of these arrays; the Bullet object keeps the rest (owner,
+ * attack, level) and reads its motion through its slot. advance() moves
+ * every live bullet in one pass over the arrays instead of one virtual
+ * update() per heap object.
+ *
+ * Each EntityWorld owns one, and a bullet takes its slot from the store of
+ * the world it is built in. Slots are freed when their bullet is destroyed,
+ * so the store must outlive the bullets it holds.
+ */
+class BulletStore {
+public:
+    BulletStore() = default;
+    ~BulletStore() = default;
+
+    BulletStore(const BulletStore&) = delete;
+    BulletStore& operator=(const BulletStore&) = delete;
+
+    // Moves every live bullet one step. A bullet leaving the map stops just
+    // past its edge and stays alive, so its segment can still be traced.
+    void advance();
+    // Kills the live bullets that have left the map; call once this tick's
+    // contacts are resolved
+    void retireOutOfBounds();
+
+    // Bullets currently holding a slot
+    std::size_t getBulletCount() const { return objects_.size() - freeSlots_.size(); }
+
+private:
+    friend class Bullet;
+
+    std::vector<Vector2> positions_;
+    std::vector<Vector2> segmentStarts_;  // Position before the last step
+    std::vector<Direction> directions_;
+    std::vector<float> speeds_;
+    std::vector<std::uint8_t> alive_;     // Not hit and still active
+    std::vector<Bullet*> objects_;        // Null for free slots
+    std::vector<std::uint32_t> freeSlots_;
+
+    std::uint32_t allocate(Bullet* object);
+    void release(std::uint32_t slot);
+    // One step of slot; returns false if the bullet left the map
+    bool step(std::uint32_t slot);
+    static bool isInsideMap(const Vector2& position);
+};
+
+} // namespace tank
@@ -3,6 +3,7 @@
 #include "entities/tanks/Tank.hpp"
 #include "ai/IAIBehavior.hpp"
 #include "utils/Constants.hpp"
+#include "utils/Random.hpp"
 #include <memory>
 
 namespace tank {
@@ -12,7 +13,7 @@ namespace tank {
  */
 class EnemyTank : public Tank {
 public:
-    EnemyTank(const Vector2& position, EnemyType type);
+    EnemyTank(EntityWorld& world, const Vector2& position, EnemyType type);
     ~EnemyTank() override = default;
 
     // Enemy type
@@ -33,7 +34,7 @@ public:
     void decrementStep() { step_--; }
 
     // Random shooting
-    void randomFire();
+    void randomFire(RandomStream& random);
     bool shouldFire() const { return fireChance_ >= 1 && fireChance_ <= 5; }
 
     // Power-up carrying
@@ -11,7 +11,7 @@ namespace tank {
  */
 class PlayerTank : public Tank {
 public:
-    PlayerTank(int playerId, const Vector2& spawnPosition);
+    PlayerTank(EntityWorld& world, int playerId, const Vector2& spawnPosition);
     ~PlayerTank() override = default;
 
     // Player identity
@@ -9,6 +9,7 @@
 namespace tank {
 
 // Forward declaration
+class EntityWorld;
 class PlayingState;
 
 /**
@@ -17,11 +18,18 @@ class PlayingState;
  */
 class Tank : public ITank {
 public:
-    Tank(const Vector2& position);
-    ~Tank() override = default;
+    Tank(EntityWorld& world, const Vector2& position);
+    ~Tank() override;
+
+    // Registered under one handle for life
+    Tank(const Tank&) = delete;
+    Tank& operator=(const Tank&) = delete;
 
     // IEntity implementation
     int getId() const override { return id_; }
+    EntityHandle getHandle() const override { return handle_; }
+    EntityKind getKind() const override { return kind_; }
+    Team getTeam() const override { return team_; }
     Vector2 getPosition() const override { return position_; }
     void setPosition(const Vector2& pos) override { position_ = pos; }
     Rectangle getBounds() const override;
@@ -73,6 +81,15 @@ public:
     // Force update previousPosition (used after collision resolution)
     void updatePreviousPosition() { previousPosition_ = position_; }
 
+    // Render interpolation (see Entity::snapshotTransform). previousPosition_
+    // is the collision rollback point, so the tick start is kept separately.
+    void snapshotTransform() { tickStartPosition_ = position_; }
+    void setRenderAlpha(float alpha) { renderAlpha_ = alpha; }
+    Vector2 getRenderPosition() const {
+        return Vector2::interpolate(tickStartPosition_, position_, renderAlpha_,
+                                    Constants::MAX_INTERPOLATION_DISTANCE);
+    }
+
 protected:
     // Subclass hooks
     virtual void onUpdate(float deltaTime) {}
@@ -82,13 +99,19 @@ protected:
     virtual void onUpgrade() {}
     virtual void onSpawn() {}
 
-    // ID
+    // World, ID and type tags (kind and team set by PlayerTank / EnemyTank)
+    EntityWorld& world_;
     int id_;
     static std::atomic<int> nextId_;
+    EntityHandle handle_;
+    EntityKind kind_ = EntityKind::Unknown;
+    Team team_ = Team::Neutral;
 
     // Position and movement
     Vector2 position_;
     Vector2 previousPosition_;
+    Vector2 tickStartPosition_;
+    float renderAlpha_ = 1.0f;
     float speed_ = Constants::PLAYER_DEFAULT_SPEED;
     Direction direction_ = Direction::Up;
 
@@ -14,7 +14,7 @@ class IRenderer;
  */
 class Base : public Entity, public IDamageable {
 public:
-    Base(int x, int y);
+    Base(EntityWorld& world, int x, int y);
     ~Base() override = default;
 
     void update(float deltaTime) override;
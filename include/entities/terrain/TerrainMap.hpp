@@ -0,0 +1,176 @@
+#pragma once
+
+#include "utils/Constants.hpp"
+#include "utils/Rectangle.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief How one terrain material behaves; looked up per cell
+ */
+struct TerrainMaterial {
+    static constexpr int NEVER_BREAKS = -1;
+
+    bool blocksTanks;
+    bool blocksBullets;
+    int breakLevel;   // Lowest bullet level that clears a cell, or NEVER_BREAKS
+    int breakAttack;  // Least bullet attack that does
+    RenderLayer layer;
+
+    bool isBrokenBy(int bulletLevel, int bulletAttack) const {
+        return breakLevel != NEVER_BREAKS && bulletLevel >= breakLevel && bulletAttack >= breakAttack;
+    }
+    // Cleared by an unupgraded tank's shot, so a path may go through it
+    bool isBrokenByBasicShot() const { return isBrokenBy(0, Constants::BULLET_DEFAULT_ATTACK); }
+};
+
+const TerrainMaterial& getTerrainMaterial(TerrainType type);
+
+struct TerrainCell {
+    int x = -1;
+    int y = -1;
+
+    bool operator==(const TerrainCell& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const TerrainCell& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief The level's terrain as one material byte per CELL_SIZE cell
+ *
+ * A brick "corner" is exactly one cell, so a destroyed cell simply becomes
+ * Empty and no further damage state is needed. Behavior comes from
+ * getTerrainMaterial(). The map is also its own spatial index: queries
+ * visit only the cells under the query area.
+ */
+class TerrainMap {
+public:
+    explicit TerrainMap(int width = Constants::GRID_WIDTH, int height = Constants::GRID_HEIGHT);
+
+    // Resizes to width x height empty cells
+    void reset(int width, int height);
+    void clear();
+
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    bool contains(int x, int y) const { return x >= 0 && y >= 0 && x < width_ && y < height_; }
+
+    // Empty outside the map
+    TerrainType get(int x, int y) const {
+        return contains(x, y) ? cells_[index(x, y)] : TerrainType::Empty;
+    }
+    TerrainType get(TerrainCell cell) const { return get(cell.x, cell.y); }
+    // Ignored outside the map
+    void set(int x, int y, TerrainType type);
+
+    // Non-empty cells
+    std::size_t getTerrainCount() const { return count_; }
+    const std::vector<TerrainType>& getCells() const { return cells_; }
+
+    static Rectangle getCellBounds(TerrainCell cell) {
+        const float size = static_cast<float>(Constants::CELL_SIZE);
+        return Rectangle(cell.x * size, cell.y * size, size, size);
+    }
+
+    // Calls predicate(cell, type) for each non-empty cell overlapping area
+    // (edges that only touch do not count, matching Rectangle::intersects);
+    // stops and returns true at the first one it accepts.
+    template<typename Predicate>
+    bool anyOf(const Rectangle& area, Predicate&& predicate) const;
+
+    // Walks the non-empty cells swept by box moving by delta in travel
+    // order, one column (or row) at a time, DDA-style. visit(cell, type)
+    // computes the cell's time of impact and lowers earliest if it is
+    // sooner; the walk stops at the first slab the box cannot reach before
+    // earliest. Diagonal motion falls back to one pass over the swept area.
+    template<typename Visitor>
+    void sweep(const Rectangle& box, const Vector2& delta, const float& earliest, Visitor&& visit) const;
+
+private:
+    struct CellRange {
+        int minX;
+        int minY;
+        int maxX;
+        int maxY;
+        bool empty() const { return maxX < minX || maxY < minY; }
+    };
+
+    int width_ = 0;
+    int height_ = 0;
+    std::size_t count_ = 0;
+    std::vector<TerrainType> cells_;  // Row-major
+
+    std::size_t index(int x, int y) const { return static_cast<std::size_t>(y * width_ + x); }
+    // Cells overlapped by area, clamped to the map
+    CellRange cellsFor(const Rectangle& area) const;
+};
+
+// Template implementation
+template<typename Predicate>
+bool TerrainMap::anyOf(const Rectangle& area, Predicate&& predicate) const {
+    const CellRange range = cellsFor(area);
+    if (range.empty()) {
+        return false;
+    }
+
+    for (int y = range.minY; y <= range.maxY; ++y) {
+        for (int x = range.minX; x <= range.maxX; ++x) {
+            const TerrainType type = cells_[index(x, y)];
+            if (type != TerrainType::Empty && predicate(TerrainCell{x, y}, type)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template<typename Visitor>
+void TerrainMap::sweep(const Rectangle& box, const Vector2& delta, const float& earliest, Visitor&& visit) const {
+    const CellRange range = cellsFor(box.swept(delta));
+    if (range.empty()) {
+        return;
+    }
+
+    const bool alongX = delta.x != 0.0f && delta.y == 0.0f;
+    const bool alongY = delta.y != 0.0f && delta.x == 0.0f;
+    if (!alongX && !alongY) {
+        anyOf(box.swept(delta), [&visit](TerrainCell cell, TerrainType type) {
+            visit(cell, type);
+            return false;
+        });
+        return;
+    }
+
+    const float size = static_cast<float>(Constants::CELL_SIZE);
+    const float speed = alongX ? delta.x : delta.y;
+    const int first = speed > 0.0f ? (alongX ? range.minX : range.minY) : (alongX ? range.maxX : range.maxY);
+    const int last = speed > 0.0f ? (alongX ? range.maxX : range.maxY) : (alongX ? range.minX : range.minY);
+    const int step = speed > 0.0f ? 1 : -1;
+    // Leading edge of the box along the travel axis
+    const float lead = alongX ? (speed > 0.0f ? box.right() : box.left())
+                              : (speed > 0.0f ? box.bottom() : box.top());
+    const int crossMin = alongX ? range.minY : range.minX;
+    const int crossMax = alongX ? range.maxY : range.maxX;
+
+    for (int slab = first; slab != last + step; slab += step) {
+        // Time at which the leading edge reaches this slab
+        const float edge = speed > 0.0f ? slab * size : (slab + 1) * size;
+        const float reachTime = std::max(0.0f, (edge - lead) / speed);
+        if (reachTime >= earliest) {
+            return;
+        }
+
+        for (int cross = crossMin; cross <= crossMax; ++cross) {
+            const int x = alongX ? slab : cross;
+            const int y = alongX ? cross : slab;
+            const TerrainType type = cells_[index(x, y)];
+            if (type != TerrainType::Empty) {
+                visit(TerrainCell{x, y}, type);
+            }
+        }
+    }
+}
+
+} // namespace tank
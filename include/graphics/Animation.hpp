@@ -1,11 +1,11 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <cstdint>
 
 namespace tank {
 
-struct SDL_Texture;
 class IRenderer;
 
 /**
@@ -18,6 +18,7 @@ struct Frame {
     int height;     // Frame height
     int duration;   // Frame duration in milliseconds
 
+    Frame() : Frame(0, 0, 0, 0, 0) {}
     Frame(int x, int y, int w, int h, int dur)
         : srcX(x), srcY(y), width(w), height(h), duration(dur) {}
 };
@@ -45,12 +46,18 @@ private:
 
 /**
  * @brief Animation controller for sprite-based animations
+ *
+ * Frames are stored inline (up to MAX_FRAMES), so creating an animated
+ * effect or power-up does not allocate.
  */
 class Animation {
 public:
     Animation();
     Animation(const std::vector<Frame>& frames, int frameDelay);
 
+    static constexpr int MAX_FRAMES = 8;
+
+    // At most MAX_FRAMES; more is a programming error and asserts
     void addFrame(const Frame& frame);
     void setFrameDelay(int delayMs) { frameDelay_ = delayMs; }
 
@@ -69,7 +76,8 @@ public:
     int getTimesPlayed() const { return timesPlayed_; }
 
 private:
-    std::vector<Frame> frames_;
+    std::array<Frame, MAX_FRAMES> frames_;
+    int frameCount_ = 0;
     int currentFrame_;
     int frameDelay_;        // Delay between frames in ms
     float elapsedTime_;     // Time accumulated
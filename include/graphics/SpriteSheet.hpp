@@ -66,7 +66,7 @@ namespace Tank {
  */
 namespace Terrain {
     // Brick wall - full 16x16 brick tile at row 5, col 18 (verified in tank_sprite.png).
-    // BrickWall renders each alive 17x17 corner from this tile, so the
+    // Each brick cell draws the top-left 17x17 of this tile, so the
     // destruction-variant tiles are not needed.
     constexpr int BRICK_X = 18 * ELEMENT_SIZE;  // 612
     constexpr int BRICK_Y = 5 * ELEMENT_SIZE;   // 170
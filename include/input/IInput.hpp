@@ -1,6 +1,6 @@
 #pragma once
 
-#include <SDL2/SDL.h>
+#include "input/KeyCodes.hpp"
 #include <cstdint>
 
 namespace tank {
@@ -15,11 +15,11 @@ public:
     virtual ~IInput() = default;
 
     // Keyboard state
-    virtual bool isKeyDown(SDL_Keycode key) const = 0;
-    virtual bool isKeyDown(SDL_Scancode scancode) const = 0;
-    virtual bool isKeyPressed(SDL_Keycode key) const = 0;
-    virtual bool isKeyPressed(SDL_Scancode scancode) const = 0;
-    virtual bool isKeyReleased(SDL_Keycode key) const = 0;
+    virtual bool isKeyDown(Keycode key) const = 0;
+    virtual bool isKeyDown(Scancode scancode) const = 0;
+    virtual bool isKeyPressed(Keycode key) const = 0;
+    virtual bool isKeyPressed(Scancode scancode) const = 0;
+    virtual bool isKeyReleased(Keycode key) const = 0;
 
     // Mouse state
     virtual int getMouseX() const = 0;
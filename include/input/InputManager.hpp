@@ -5,8 +5,10 @@
 #include "input/PlayerInput.hpp"
 #include <SDL2/SDL.h>
 #include <array>
+#include <bitset>
+#include <cstdint>
 #include <functional>
-#include <unordered_set>
+#include <vector>
 
 namespace tank {
 
@@ -25,42 +27,72 @@ struct InputEvent {
     };
 
     Type type = Type::None;
-    SDL_Keycode keycode = 0;
+    Keycode keycode = Keycode::Unknown;
+    Scancode scancode = Scancode::Unknown;
     int mouseX = 0;
     int mouseY = 0;
     int mouseButton = 0;
+    uint32_t timestamp = 0;  // SDL_GetTicks() time the event arrived, in ms
 };
 
 /**
  * @brief Key mapping for a player
  */
 struct KeyMapping {
-    SDL_Scancode up;
-    SDL_Scancode down;
-    SDL_Scancode left;
-    SDL_Scancode right;
-    SDL_Scancode fire;
+    Scancode up;
+    Scancode down;
+    Scancode left;
+    Scancode right;
+    Scancode fire;
 };
 
 /**
  * @brief Input manager - handles SDL events and keyboard state
+ * Translates SDL scancodes/keycodes into the engine's own key types.
+ *
+ * Key and mouse events are timestamped and queued by processEvents(); each
+ * simulation tick then calls beginTick() with its cutoff time and sees
+ * exactly the events that arrived before it. Edges (pressed/released) are
+ * therefore per tick: never repeated across catch-up ticks and never a
+ * whole rendered frame late. Key state lives in flat bitsets.
  */
 class InputManager : public IInput {
 public:
     InputManager();
 
-    // Process all pending SDL events
+    // Poll SDL, handle quit/window events immediately and queue the rest
     void processEvents();
 
+    // Queue an input event (used by processEvents; also for replays/tests)
+    void queueEvent(const InputEvent& event);
+
+    // Start a simulation tick: apply every queued event stamped at or before
+    // tickTime (ms, SDL_GetTicks domain) and recompute per-tick edges.
+    void beginTick(uint32_t tickTime);
+
+    // SDL_GetTicks() at the last processEvents() call
+    uint32_t getLastPollTime() const { return lastPollTime_; }
+    size_t getPendingEventCount() const { return pendingEvents_.size() - pendingHead_; }
+
     // Check if quit was requested
     bool shouldQuit() const { return quit_; }
 
+    // Sleep until an event arrives or timeoutMs passes (events stay queued
+    // for the next processEvents). Returns true if woken by an event.
+    bool waitForEvents(uint32_t timeoutMs);
+
+    // Window state tracked from SDL window events; nothing needs drawing
+    // while the window is hidden, minimized or unfocused.
+    bool isWindowVisible() const { return windowVisible_; }
+    bool isWindowFocused() const { return windowFocused_; }
+    bool isWindowActive() const { return windowVisible_ && windowFocused_; }
+
     // Keyboard state
-    bool isKeyDown(SDL_Keycode key) const override;
-    bool isKeyDown(SDL_Scancode scancode) const override;  // Scancode version
-    bool isKeyPressed(SDL_Keycode key) const override;  // Just pressed this frame
-    bool isKeyPressed(SDL_Scancode scancode) const override;  // Scancode version
-    bool isKeyReleased(SDL_Keycode key) const override; // Just released this frame
+    bool isKeyDown(Keycode key) const override;
+    bool isKeyDown(Scancode scancode) const override;  // Scancode version
+    bool isKeyPressed(Keycode key) const override;  // Just pressed this frame
+    bool isKeyPressed(Scancode scancode) const override;  // Scancode version
+    bool isKeyReleased(Keycode key) const override; // Just released this frame
 
     // Mouse state
     int getMouseX() const override { return mouseX_; }
@@ -76,19 +108,30 @@ public:
     using EventCallback = std::function<void(const InputEvent&)>;
     void setEventCallback(EventCallback callback) { eventCallback_ = callback; }
 
-    // Update (call at end of frame)
-    void update();
-
 private:
     bool quit_ = false;
+    bool windowVisible_ = true;
+    bool windowFocused_ = true;
     EventCallback eventCallback_;
 
-    // Keyboard state
-    // eventKeys_: Keys pressed this frame (KeyDown edge) for isKeyPressed()
-    std::array<bool, SDL_NUM_SCANCODES> eventKeys_{};
-    std::unordered_set<SDL_Keycode> currentKeycodes_{};
-    std::unordered_set<SDL_Keycode> previousKeycodes_{};
-    std::unordered_set<SDL_Keycode> eventKeycodes_{};  // Keycodes pressed this frame (KeyDown edge)
+    // Keycodes map into KEYCODE_SLOTS: printable characters (< 128) keep
+    // their value, SDL's scancode-derived keycodes follow at 128 + scancode.
+    static constexpr int PRINTABLE_KEYCODES = 128;
+    static constexpr int KEYCODE_SLOTS = PRINTABLE_KEYCODES + SCANCODE_COUNT;
+    static int keycodeSlot(Keycode key);
+
+    // Keyboard state as of the current tick
+    // pressed*: KeyDown edges applied in this tick, for isKeyPressed()
+    std::bitset<SCANCODE_COUNT> currentKeys_;
+    std::bitset<SCANCODE_COUNT> pressedKeys_;
+    std::bitset<KEYCODE_SLOTS> currentKeycodes_;
+    std::bitset<KEYCODE_SLOTS> previousKeycodes_;
+    std::bitset<KEYCODE_SLOTS> pressedKeycodes_;
+
+    // Events waiting for their tick; consumed from pendingHead_ onwards
+    std::vector<InputEvent> pendingEvents_;
+    size_t pendingHead_ = 0;
+    uint32_t lastPollTime_ = 0;
 
     // Mouse state
     int mouseX_ = 0;
@@ -101,6 +144,8 @@ private:
     std::array<KeyMapping, 2> playerMappings_;
 
     void initializeKeyMappings();
+    void applyEvent(const InputEvent& event);
+    void clearState();
 };
 
 } // namespace tank
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tank {
+
+/**
+ * @brief Physical key identifiers used by gameplay code
+ *
+ * Values follow the USB HID usage numbering that SDL scancodes also use, so
+ * the SDL backend converts with a plain cast (checked by static_asserts in
+ * InputManager.cpp). Core code never needs an SDL header to name a key.
+ */
+enum class Scancode : uint16_t {
+    Unknown = 0,
+
+    A = 4, B, C, D, E, F, G, H, I, J, K, L, M,
+    N, O, P, Q, R, S, T, U, V, W, X, Y, Z,
+
+    Num1 = 30, Num2, Num3, Num4, Num5, Num6, Num7, Num8, Num9, Num0,
+
+    Return = 40,
+    Escape = 41,
+    Backspace = 42,
+    Tab = 43,
+    Space = 44,
+    LeftBracket = 47,
+    RightBracket = 48,
+
+    F1 = 58, F2, F3, F4, F5, F6, F7, F8, F9, F10, F11, F12,
+
+    PageUp = 75,
+    Delete = 76,
+    PageDown = 78,
+    Right = 79,
+    Left = 80,
+    Down = 81,
+    Up = 82,
+
+    KeypadEnter = 88,
+
+    LeftCtrl = 224,
+    LeftShift = 225,
+    RightCtrl = 228,
+    RightShift = 229
+};
+
+// Upper bound for scancode values (matches SDL_NUM_SCANCODES).
+constexpr int SCANCODE_COUNT = 512;
+
+/**
+ * @brief Layout-dependent key identifiers (the character a key produces)
+ *
+ * Printable keys use their lowercase character, as SDL keycodes do.
+ */
+enum class Keycode : int32_t {
+    Unknown = 0,
+    Return = '\r',
+    Escape = 27,
+    Space = ' ',
+
+    A = 'a', B, C, D, E, F, G, H, I, J, K, L, M,
+    N, O, P, Q, R, S, T, U, V, W, X, Y, Z
+};
+
+/**
+ * @brief Mouse button indices (match SDL_BUTTON_*)
+ */
+namespace MouseButton {
+    constexpr uint8_t Left = 1;
+    constexpr uint8_t Middle = 2;
+    constexpr uint8_t Right = 3;
+}
+
+} // namespace tank
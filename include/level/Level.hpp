@@ -1,7 +1,6 @@
 #pragma once
 
 #include "utils/Constants.hpp"
-#include "entities/terrain/ITerrain.hpp"
 #include <vector>
 #include <memory>
 #include <string>
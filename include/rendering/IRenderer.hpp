@@ -3,12 +3,23 @@
 #include "utils/Rectangle.hpp"
 #include "utils/Constants.hpp"
 #include <string>
+#include <cstdint>
 #include <memory>
 
-struct SDL_Texture;
-
 namespace tank {
 
+/**
+ * @brief Opaque reference to a texture owned by an IRenderer
+ * A default-constructed handle (id 0) refers to no texture.
+ */
+struct TextureHandle {
+    uint32_t id = 0;
+
+    explicit operator bool() const { return id != 0; }
+    bool operator==(const TextureHandle& other) const { return id == other.id; }
+    bool operator!=(const TextureHandle& other) const { return id != other.id; }
+};
+
 /**
  * @brief Abstract renderer interface (DIP - Dependency Inversion)
  * High-level modules depend on this interface, not concrete SDL implementation
@@ -29,9 +40,9 @@ public:
     virtual void drawRectangle(const Rectangle& rect, const Constants::Color& color, bool filled = true) = 0;
 
     // Texture operations
-    virtual SDL_Texture* loadTexture(const std::string& path) = 0;
-    virtual void drawTexture(SDL_Texture* texture, const Rectangle& dest) = 0;
-    virtual void drawTexture(SDL_Texture* texture, const Rectangle& src, const Rectangle& dest) = 0;
+    virtual TextureHandle loadTexture(const std::string& path) = 0;
+    virtual void drawTexture(TextureHandle texture, const Rectangle& dest) = 0;
+    virtual void drawTexture(TextureHandle texture, const Rectangle& src, const Rectangle& dest) = 0;
 
     // Text rendering
     virtual void drawText(const std::string& text, const Vector2& pos,
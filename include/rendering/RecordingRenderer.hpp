@@ -0,0 +1,80 @@
+#pragma once
+
+#include "rendering/IRenderer.hpp"
+#include "rendering/RenderCommandList.hpp"
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace tank {
+
+/**
+ * @brief IRenderer that records draw calls instead of issuing them
+ *
+ * States render into this on the main thread; present() hands the finished
+ * list to the submit callback (normally RenderThread::submit) and continues
+ * with an empty one. Queries that need an answer now - measureText and the
+ * window size - go to the backend, which must allow them from this thread.
+ * Textures get recorder-side handles at once; the backend loads them when
+ * the recorded LoadTexture command is replayed.
+ */
+class RecordingRenderer : public IRenderer {
+public:
+    using SubmitFunction = std::function<void(RenderCommandList& frame)>;
+
+    RecordingRenderer(IRenderer& backend, SubmitFunction submit);
+
+    bool initialize(const std::string& title, int width, int height) override;
+    void shutdown() override;
+
+    void clear() override { frame_.clearScreen(); }
+    void present() override;
+
+    void drawRectangle(const Rectangle& rect, const Constants::Color& color,
+                       bool filled = true) override {
+        frame_.drawRectangle(rect, color, filled);
+    }
+
+    TextureHandle loadTexture(const std::string& path) override;
+    void drawTexture(TextureHandle texture, const Rectangle& dest) override {
+        frame_.drawTexture(texture, dest);
+    }
+    void drawTexture(TextureHandle texture, const Rectangle& src, const Rectangle& dest) override {
+        frame_.drawTexture(texture, src, dest);
+    }
+
+    void drawText(const std::string& text, const Vector2& pos,
+                  const Constants::Color& color, int fontSize = 16) override {
+        frame_.drawText(text, pos, color, fontSize);
+    }
+    Vector2 measureText(const std::string& text, int fontSize = 16) override {
+        return backend_.measureText(text, fontSize);
+    }
+
+    int getWidth() const override { return backend_.getWidth(); }
+    int getHeight() const override { return backend_.getHeight(); }
+
+    void setDrawColor(const Constants::Color& color) override { frame_.setDrawColor(color); }
+    void clear(uint8_t r, uint8_t g, uint8_t b, uint8_t a) override { frame_.clearScreen(r, g, b, a); }
+    void drawRect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override {
+        frame_.fillRect(x, y, w, h, r, g, b, a);
+    }
+
+    void drawSprite(int srcX, int srcY, int srcW, int srcH,
+                    int destX, int destY, int destW, int destH) override {
+        frame_.drawSprite(srcX, srcY, srcW, srcH, destX, destY, destW, destH);
+    }
+    void setSpriteSheet(const std::string& path) override { frame_.setSpriteSheet(path); }
+
+    // The frame being recorded (for tests and diagnostics)
+    const RenderCommandList& getFrame() const { return frame_; }
+
+private:
+    IRenderer& backend_;
+    SubmitFunction submit_;
+    RenderCommandList frame_;
+    std::unordered_map<std::string, TextureHandle> textureCache_;
+    uint32_t nextTextureId_ = 1;
+};
+
+} // namespace tank
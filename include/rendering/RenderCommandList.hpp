@@ -0,0 +1,87 @@
+#pragma once
+
+#include "rendering/IRenderer.hpp"
+#include "utils/Constants.hpp"
+#include "utils/Rectangle.hpp"
+#include "utils/Vector2.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief One recorded IRenderer call
+ * Plain data; text and paths live in the owning list's string buffer.
+ */
+struct RenderCommand {
+    enum class Type : uint8_t {
+        Clear,
+        ClearColor,
+        SetDrawColor,
+        FillRect,           // drawRect
+        Rectangle,          // drawRectangle (filled or outline)
+        Sprite,
+        Texture,
+        TextureRegion,
+        Text,
+        LoadTexture,        // Binds a recorder handle to a backend texture
+        SetSpriteSheet
+    };
+
+    Type type = Type::Clear;
+    bool filled = true;
+    int fontSize = 0;
+    Constants::Color color{0, 0, 0, 255};
+    int32_t values[8] = {};          // Sprite src/dest or rect x, y, w, h
+    tank::Rectangle src;
+    tank::Rectangle dest;
+    Vector2 position;
+    TextureHandle texture;
+    uint32_t textOffset = 0;
+    uint32_t textLength = 0;
+};
+
+/**
+ * @brief A frame's worth of recorded draw calls
+ *
+ * Recording only appends to two vectors whose capacity survives clear(), so
+ * steady-state frames do not allocate. replay() issues the calls, in order,
+ * against a real renderer.
+ */
+class RenderCommandList {
+public:
+    // Backend handle for each recorder handle id (index id - 1), filled in
+    // by replayed LoadTexture commands. Owned by whoever replays.
+    using TextureTable = std::vector<TextureHandle>;
+
+    void clear();
+    bool empty() const { return commands_.empty(); }
+    size_t size() const { return commands_.size(); }
+    const std::vector<RenderCommand>& getCommands() const { return commands_; }
+    std::string getText(const RenderCommand& command) const;
+
+    void clearScreen();
+    void clearScreen(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+    void setDrawColor(const Constants::Color& color);
+    void fillRect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+    void drawRectangle(const tank::Rectangle& rect, const Constants::Color& color, bool filled);
+    void drawSprite(int srcX, int srcY, int srcW, int srcH,
+                    int destX, int destY, int destW, int destH);
+    void drawTexture(TextureHandle texture, const tank::Rectangle& dest);
+    void drawTexture(TextureHandle texture, const tank::Rectangle& src, const tank::Rectangle& dest);
+    void drawText(const std::string& text, const Vector2& pos, const Constants::Color& color, int fontSize);
+    void loadTexture(const std::string& path, TextureHandle handle);
+    void setSpriteSheet(const std::string& path);
+
+    void replay(IRenderer& target, TextureTable& textures) const;
+
+private:
+    std::vector<RenderCommand> commands_;
+    std::string strings_;
+
+    RenderCommand& append(RenderCommand::Type type);
+    void storeText(RenderCommand& command, const std::string& text);
+};
+
+} // namespace tank
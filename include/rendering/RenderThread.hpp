@@ -0,0 +1,60 @@
+#pragma once
+
+#include "rendering/IRenderer.hpp"
+#include "rendering/RenderCommandList.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace tank {
+
+/**
+ * @brief Replays recorded frames on a dedicated thread
+ *
+ * Double buffered: while the render thread replays and presents frame N, the
+ * main thread simulates and records frame N+1. submit() blocks only if frame
+ * N is still being drawn, so at most one frame is ever in flight. The backend
+ * is touched exclusively from the render thread between start() and stop().
+ */
+class RenderThread {
+public:
+    explicit RenderThread(IRenderer& backend);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // Runs setUp on the new thread (e.g. creating the GPU renderer) and
+    // returns its result; tearDown runs there after the last frame.
+    bool start(std::function<bool()> setUp = {}, std::function<void()> tearDown = {});
+    void stop();
+    bool isRunning() const { return thread_.joinable(); }
+
+    // Hands over a recorded frame; on return `frame` is an empty list that
+    // reuses the previous frame's storage.
+    void submit(RenderCommandList& frame);
+    // Blocks until every submitted frame has been presented.
+    void waitIdle();
+
+    uint64_t getFramesPresented() const;
+
+private:
+    IRenderer& backend_;
+    std::thread thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable frameQueued_;
+    std::condition_variable frameDone_;
+
+    RenderCommandList pending_;   // Owned by the render thread while drawing_
+    RenderCommandList::TextureTable textures_;
+    bool frameReady_ = false;
+    bool drawing_ = false;
+    bool stopping_ = false;
+    uint64_t framesPresented_ = 0;
+
+    void run(std::function<void()> tearDown);
+};
+
+} // namespace tank
@@ -4,8 +4,10 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
+#include <mutex>
 #include <unordered_map>
 #include <string>
+#include <vector>
 #include <memory>
 
 namespace tank {
@@ -13,6 +15,10 @@ namespace tank {
 /**
  * @brief SDL2 implementation of IRenderer
  * Handles all SDL2-specific rendering operations
+ *
+ * For threaded rendering the window is created on the main thread (which
+ * pumps its events) and the SDL renderer on the render thread that then owns
+ * every draw call. measureText() may be called from any thread.
  */
 class SDLRenderer : public IRenderer {
 public:
@@ -29,9 +35,9 @@ public:
     void drawRectangle(const Rectangle& rect, const Constants::Color& color,
                        bool filled = true) override;
 
-    SDL_Texture* loadTexture(const std::string& path) override;
-    void drawTexture(SDL_Texture* texture, const Rectangle& dest) override;
-    void drawTexture(SDL_Texture* texture, const Rectangle& src,
+    TextureHandle loadTexture(const std::string& path) override;
+    void drawTexture(TextureHandle texture, const Rectangle& dest) override;
+    void drawTexture(TextureHandle texture, const Rectangle& src,
                      const Rectangle& dest) override;
 
     void drawText(const std::string& text, const Vector2& pos,
@@ -53,6 +59,17 @@ public:
                    int destX, int destY, int destW, int destH) override;
     void setSpriteSheet(const std::string& path) override;
 
+    // initialize() in two halves: window (main thread) and renderer (the
+    // thread that will draw). destroyRenderer() must run on the latter.
+    bool createWindow(const std::string& title, int width, int height);
+    bool createRenderer();
+    void destroyRenderer();
+
+    // Whether the renderer is created with PRESENTVSYNC (call before initialize)
+    void setVSyncEnabled(bool enabled) { vsyncRequested_ = enabled; }
+    // True if the driver actually honours vsync for the created renderer
+    bool isVSyncActive() const;
+
     // SDL-specific accessors
     SDL_Renderer* getSDLRenderer() { return renderer_; }
     SDL_Window* getSDLWindow() { return window_; }
@@ -63,14 +80,20 @@ private:
     SDL_Texture* spriteSheet_ = nullptr;
     int width_ = 0;
     int height_ = 0;
+    bool vsyncRequested_ = true;
 
-    // Font cache
+    // Font cache; guarded so layout code can measure text while the render
+    // thread draws
+    std::mutex fontMutex_;
     std::unordered_map<int, TTF_Font*> fontCache_;
     std::string defaultFontPath_;
 
-    // Texture cache - owns all textures loaded via loadTexture (keyed by path)
-    std::unordered_map<std::string, SDL_Texture*> textureCache_;
+    // Texture cache - owns all textures loaded via loadTexture. A handle's id
+    // is its index in textures_ plus one.
+    std::unordered_map<std::string, TextureHandle> textureCache_;
+    std::vector<SDL_Texture*> textures_;
 
+    SDL_Texture* resolveTexture(TextureHandle texture) const;
     TTF_Font* getFont(int size);
     void clearFontCache();
 };
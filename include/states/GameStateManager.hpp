@@ -1,6 +1,7 @@
 #pragma once
 
 #include "states/IGameState.hpp"
+#include "core/GameContext.hpp"
 #include "utils/ProgressStore.hpp"
 #include <array>
 #include <memory>
@@ -17,8 +18,13 @@ class IInput;
 class GameStateManager {
 public:
     GameStateManager() = default;
+    explicit GameStateManager(GameContext context) : context_(std::move(context)) {}
     ~GameStateManager() = default;
 
+    // Services of the world this manager drives; states reach audio etc. here.
+    const GameContext& getContext() const { return context_; }
+    void setContext(GameContext context) { context_ = std::move(context); }
+
     // State management
     void pushState(std::unique_ptr<IGameState> state);
     void popState();
@@ -33,8 +39,10 @@ public:
 
     // Update and render
     void update(float deltaTime);
-    void render(IRenderer& renderer);
+    void render(IRenderer& renderer, float alpha = 1.0f);
     void handleInput(const IInput& input);
+    // Top state's idle interval (0 while a transition is pending)
+    float getIdleRedrawInterval() const;
 
     // Access current state
     IGameState* getCurrentState();
@@ -79,6 +87,7 @@ public:
     void toggleMute();
 
 private:
+    GameContext context_;
     std::stack<std::unique_ptr<IGameState>> states_;
 
     // Pending operations (executed at end of frame)
@@ -23,10 +23,22 @@ public:
     // Update and render
     virtual void update(float deltaTime) = 0;
     virtual void render(IRenderer& renderer) = 0;
+    // alpha in [0, 1): progress from the last simulated tick towards the next.
+    // States with moving entities blend their transforms by it; the default
+    // draws the latest tick as-is.
+    virtual void renderInterpolated(IRenderer& renderer, float alpha) {
+        (void)alpha;
+        render(renderer);
+    }
 
     // Input handling
     virtual void handleInput(const IInput& input) = 0;
 
+    // Power saving: seconds until the screen next changes on its own, or 0
+    // while the state animates every frame. While positive, the loop sleeps
+    // in the event queue and redraws only on input or at that deadline.
+    virtual float getIdleRedrawInterval() const { return 0.0f; }
+
     // State type
     virtual StateType getType() const = 0;
 };
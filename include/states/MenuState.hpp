@@ -27,6 +27,7 @@ public:
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
     void handleInput(const IInput& input) override;
+    float getIdleRedrawInterval() const override;
 
     StateType getType() const override { return StateType::Menu; }
 
@@ -56,9 +57,12 @@ private:
     float animTimer_ = 0.0f;
     float fadeAlpha_ = 0.0f;
     float cursorPulse_ = 0.0f;
+    static constexpr float ICON_FRAME_SECONDS = 0.25f;  // Player-mode tank icon tread frames
+    static constexpr float CURSOR_PULSE_SPEED = 5.0f;   // Bounce phase, radians per second
+    static constexpr float CURSOR_BOUNCE_PIXELS = 3.0f;
 
     // Logo (owned by the renderer's texture cache)
-    SDL_Texture* logoTexture_ = nullptr;
+    TextureHandle logoTexture_{};
 
     // Layout
     static constexpr int LOGO_WIDTH = 440;     // scaled from 522x55 source
@@ -3,22 +3,30 @@
 #include "states/IGameState.hpp"
 #include "level/Level.hpp"
 #include "level/LevelLoader.hpp"
+#include "collision/BoxBatch.hpp"
+#include "collision/BulletLaneSchedule.hpp"
+#include "collision/ClearanceMap.hpp"
 #include "collision/CollisionManager.hpp"
+#include "collision/OccupancyBitmap.hpp"
+#include "collision/SweepAndPrune.hpp"
+#include "core/EntityWorld.hpp"
+#include "core/FrameArena.hpp"
+#include "core/WorkerPool.hpp"
 #include "entities/tanks/PlayerTank.hpp"
 #include "entities/tanks/EnemyTank.hpp"
-#include "entities/terrain/BrickWall.hpp"
-#include "entities/terrain/SteelWall.hpp"
-#include "entities/terrain/Water.hpp"
-#include "entities/terrain/Grass.hpp"
 #include "entities/terrain/Base.hpp"
+#include "entities/terrain/TerrainMap.hpp"
 #include "entities/projectiles/Bullet.hpp"
 #include "entities/effects/Effect.hpp"
 #include "entities/powerups/PowerUpManager.hpp"
 #include "ui/GameHUD.hpp"
+#include "utils/Random.hpp"
 #include <vector>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
-#include <unordered_map>
+#include <utility>
 
 namespace tank {
 
@@ -37,7 +45,12 @@ public:
     void exit() override;
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
+    void renderInterpolated(IRenderer& renderer, float alpha) override;
     void handleInput(const IInput& input) override;
+    // The paused world and pause menu are static; game over still animates
+    float getIdleRedrawInterval() const override {
+        return paused_ && !gameOver_ ? Constants::IDLE_REDRAW_INTERVAL : 0.0f;
+    }
 
     StateType getType() const override { return StateType::Playing; }
 
@@ -45,17 +58,32 @@ public:
     void pauseGame() { paused_ = true; pauseOverlay_.setActive(true); pauseOverlay_.resetSelection(); }
     void resumeGame() { paused_ = false; pauseOverlay_.setActive(false); }
     bool isPaused() const { return paused_; }
+    bool isGameOver() const { return gameOver_; }
+    bool isLevelComplete() const { return levelComplete_; }
+    // Set when the level failed to load and the default fallback was off
+    bool hasLevelLoadFailed() const { return levelLoadFailed_; }
 
     // Level management
     int getCurrentLevel() const { return currentLevel_; }
     void nextLevel();
 
+    // Reseeds power-up drops and enemy AI; call before enter() for a
+    // reproducible match.
+    void setRandomSeed(std::uint64_t seed) { random_.reseed(seed); }
+    // On by default. When off, a level that fails to load leaves the state
+    // empty and hasLevelLoadFailed() set instead of playing a blank map;
+    // call before enter().
+    void setDefaultLevelFallback(bool enabled) { defaultLevelFallback_ = enabled; }
+
     // Add entities
     void addBullet(std::unique_ptr<Bullet> bullet);
     bool spawnEnemy();
 
 private:
     GameStateManager& stateManager_;
+    // Handle table, bullet store and pools every entity below uses;
+    // declared first so it outlives them
+    EntityWorld world_;
 
     // Level data
     int currentLevel_;
@@ -64,13 +92,32 @@ private:
     std::string levelFilePath_;
     std::unique_ptr<Level> level_;
     LevelLoader levelLoader_;
+    bool defaultLevelFallback_ = true;
+    bool levelLoadFailed_ = false;
 
     // Entities
     std::unique_ptr<PlayerTank> player1_;
     std::unique_ptr<PlayerTank> player2_;
     std::vector<std::unique_ptr<EnemyTank>> enemies_;
     std::vector<std::unique_ptr<Bullet>> bullets_;
-    std::vector<std::unique_ptr<ITerrain>> terrains_;
+    // Live terrain, one material per cell; change it only through
+    // setTerrainCell()/createTerrain()/clearTerrain() so the level's map,
+    // the bitmaps below and the bullet lanes stay in step.
+    TerrainMap terrainMap_;
+    // Water is the only animated terrain; all of it shares one frame
+    float waterAnimationTimer_ = 0.0f;
+    int waterFrame_ = 0;
+    static constexpr float WATER_FRAME_DURATION = 0.5f;
+    // Per-pixel solid material: tank blocking (brick, steel, water) and
+    // bullet blocking (brick, steel).
+    OccupancyBitmap tankBlockingBits_{Constants::GRID_WIDTH * Constants::CELL_SIZE,
+                                      Constants::GRID_HEIGHT * Constants::CELL_SIZE};
+    OccupancyBitmap bulletBlockingBits_{Constants::GRID_WIDTH * Constants::CELL_SIZE,
+                                        Constants::GRID_HEIGHT * Constants::CELL_SIZE};
+    // Free space around tankBlockingBits_, for O(1) spawn and unstick tests
+    ClearanceMap tankClearance_;
+    // Living tank bounds, gathered for spawn and fortify overlap tests
+    BoxBatch tankBoxes_;
     std::unique_ptr<Base> base_;
     std::vector<std::unique_ptr<Effect>> effects_;
     PowerUpManager powerUpManager_;
@@ -85,16 +132,53 @@ private:
     std::vector<FortifiedCell> fortifiedCells_;
 
     // Enemy deaths are resolved in removeDeadEntities(), after collision and
-    // power-up handling have completed for the frame.
+    // power-up handling have completed for the frame. Only the enemies killed
+    // this tick are listed, so lookups scan the list.
     struct EnemyDefeat {
-        PlayerTank* owner = nullptr;
-        const void* damageSource = nullptr;
+        EntityHandle enemy;
+        EntityHandle owner;         // Scores only if it is still a live player
+        EntityHandle damageSource;  // The bullet; null for bombs
         bool preventsMultiplier = false;
     };
-    std::unordered_map<EnemyTank*, EnemyDefeat> enemyDefeats_;
+    std::vector<EnemyDefeat> enemyDefeats_;
 
     // Collision
     CollisionManager collisionManager_;
+    // Tanks, bullets and power-ups; kept across ticks so each tick's sort
+    // starts from the previous order.
+    SweepAndPrune broadphase_;
+    std::vector<SweepAndPrune::Pair> broadphasePairs_;
+    // Per-tick scratch of the collision pass and removeDeadEntities(),
+    // released at the start of each checkCollisions()
+    FrameArena frameArena_;
+    // How far a bullet's damage box reaches past its contact point
+    static constexpr float CONTACT_DEPTH = 1.0f;
+
+    // Contacts are generated against a read-only world, per lane, and
+    // resolved afterwards in bullet order (see checkCollisions()).
+    using IndexPairs = FrameVector<std::pair<size_t, size_t>>;
+    using TankList = FrameVector<Tank*>;
+    struct BulletContact {
+        enum class Target : uint8_t { Base, Terrain, Tank };
+        size_t bulletIndex;
+        Target target;
+        TerrainCell cell;
+        Tank* tank;
+        float time;  // Fraction of the bullet's segment
+    };
+    struct ContactLane {
+        std::vector<BulletContact> bulletContacts;
+        std::vector<std::pair<size_t, size_t>> bulletPairs;
+    };
+    std::vector<ContactLane> contactLanes_;
+    // Static impacts (terrain, base) come from each bullet's traced lane;
+    // dueLanes_[i] is bullet i's lane if it falls due this tick.
+    BulletLaneSchedule bulletLanes_;
+    std::vector<const BulletLaneSchedule::Lane*> dueLanes_;
+    // Started on the first tick with enough bullets to be worth splitting
+    std::unique_ptr<WorkerPool> collisionWorkers_;
+    size_t parallelContactThreshold_ = 256;
+    static constexpr size_t MAX_COLLISION_WORKERS = 3;
 
     // Game state
     bool paused_;
@@ -123,17 +207,44 @@ private:
     // Debug mode
     bool debugMode_ = false;
 
+    // World RNG: power-up drops draw from its world stream, and every
+    // spawned enemy's AI gets its own stream.
+    WorldRandom random_;
+
     // Methods
     void loadLevel();
+    // Builds the live map from the level's
     void createTerrain();
+    // Empties the live map and the level's terrain (the base cells stay)
+    void clearTerrain();
+    // Changes one cell in the live map and the level's map, and updates the
+    // occupancy bits, the clearance map and the bullet lanes crossing it.
+    // Mid-game terrain edits go through here; none needs a rebuild.
+    void setTerrainCell(int x, int y, TerrainType material);
     void createPlayers();
     void setupCollisionHandlers();
 
+    void snapshotTransforms();
+    void setRenderAlpha(float alpha);
     void updateEntities(float deltaTime);
     void updateTimedPowerUps(float deltaTime);
     void updateEffects(float deltaTime);
     void checkCollisions();
     void checkTankTerrainCollisions();
+    void generateContacts(const TankList& tanks, const IndexPairs& bulletTankPairs,
+                          const IndexPairs& bulletPairs);
+    void scheduleBulletLanes();
+    void traceBulletLane(size_t bulletIndex);
+    std::int64_t getLaneDueTick(const BulletLaneSchedule::Lane& lane, const Bullet& bullet) const;
+    // First contact of a box moving by delta with the base or terrain
+    std::optional<BulletContact> traceStatic(const Rectangle& box, const Vector2& delta) const;
+    // First contact of a bullet's segment with the world as it is now. With
+    // useLanes, static obstacles come from dueLanes_ instead of a trace.
+    std::optional<BulletContact> traceBullet(size_t bulletIndex, const TankList& tanks,
+                                             const IndexPairs& bulletTankPairs, bool useLanes) const;
+    // Whether an earlier resolution left this contact's target unchanged
+    bool isBulletContactCurrent(const BulletContact& contact) const;
+    void resolveBulletContact(const BulletContact& contact);
     void removeDeadEntities();
     void checkGameState(float deltaTime);
 
@@ -147,17 +258,22 @@ private:
     void handleGameOverMenuInput(const IInput& input);
 
     void renderTerrain(IRenderer& renderer);
+    void renderTerrainCells(IRenderer& renderer, RenderLayer layer) const;
     void renderEntities(IRenderer& renderer);
     void renderUI(IRenderer& renderer);
     void renderDebugBounds(IRenderer& renderer);
 
     void handleTankShooting(Tank& tank);
     Vector2 calculateBulletSpawnPosition(const Tank& tank) const;
-    void detachBulletsFromTank(ITank* tank);
-    void detachAllBulletOwners();
     bool isTankSpawnAreaFree(const Vector2& position) const;
-    // True if any living tank (players or enemies) overlaps the given area.
-    bool isAnyTankOverlapping(const Rectangle& area) const;
+    // Same test against tank bounds already gathered by collectTankBoxes()
+    bool isTankSpawnAreaFree(const Vector2& position, const BoxBatch& tanks) const;
+    // True if live tank-blocking terrain (solid brick corners, steel, water)
+    // overlaps the given area. Answered from tankBlockingBits_.
+    bool isTerrainBlockingTank(const Rectangle& area) const;
+    // Replaces out with the bounds of every living tank (players and
+    // enemies), so several areas can be tested against them in batches.
+    void collectTankBoxes(BoxBatch& out) const;
     // Removes tank-blocking terrain (brick/steel/water) from the cells under
     // every spawn point. Player tanks spawn unconditionally and the enemy
     // spawner deadlocks when all its points are blocked, so spawn cells must
@@ -167,13 +283,10 @@ private:
     void applyPowerUp(PlayerTank& player, PowerUpType type);
     void fortifyBase();
     void restoreFortifiedBase();
-    // Copies live destructible-terrain state (brick corners / steel) back into
-    // the level map. Bullets only damage terrain entities, so the map is stale
-    // until synced; call before any full createTerrain() rebuild.
-    void syncDestructibleTerrainToMap();
     PowerUpType chooseRandomPowerUp();
-    void registerEnemyDefeat(EnemyTank& enemy, PlayerTank* owner,
-                             const void* damageSource = nullptr, bool fromBomb = false);
+    void registerEnemyDefeat(EnemyTank& enemy, EntityHandle owner,
+                             EntityHandle damageSource = EntityHandle(), bool fromBomb = false);
+    const EnemyDefeat* findEnemyDefeat(const EnemyTank& enemy) const;
     void configureEnemyAI(EnemyTank& enemy);
 };
 
@@ -21,6 +21,10 @@ public:
     void update(float deltaTime) override;
     void render(IRenderer& renderer) override;
     void handleInput(const IInput& input) override;
+    // Static once the tally has finished counting up
+    float getIdleRedrawInterval() const override {
+        return animationComplete_ ? Constants::IDLE_REDRAW_INTERVAL : 0.0f;
+    }
 
     StateType getType() const override { return StateType::Score; }
 
@@ -34,8 +34,11 @@ constexpr int TANK_COLLISION_SIZE = ELEMENT_SIZE - TANK_COLLISION_MARGIN * 2;
 
 // Timing
 constexpr float TARGET_FPS = 60.0f;
-constexpr float FRAME_TIME = 1000.0f / TARGET_FPS;
 constexpr float FIXED_DELTA_TIME = 1.0f / TARGET_FPS;
+// Idle states with nothing animating still redraw this often (seconds)
+constexpr float IDLE_REDRAW_INTERVAL = 1.0f;
+// Per-tick moves longer than this are drawn as teleports, not interpolated
+constexpr float MAX_INTERPOLATION_DISTANCE = 24.0f;
 
 // Game timing (in milliseconds, from original Java)
 constexpr int ENEMY_SPAWN_INTERVAL = 3500;
@@ -290,7 +293,7 @@ enum class EnemyType {
 /**
  * @brief Terrain types for level data
  */
-enum class TerrainType {
+enum class TerrainType : uint8_t {
     Empty = 0,
     Steel = 1,
     Brick = 2,
@@ -299,6 +302,36 @@ enum class TerrainType {
     Base = 5
 };
 
+/**
+ * @brief Concrete entity kind, read in place of dynamic_cast by collision
+ * and damage code
+ */
+enum class EntityKind : uint8_t {
+    Unknown = 0,
+    PlayerTank,
+    EnemyTank,
+    Bullet,
+    Base,
+    PowerUp,
+    Effect,
+    Count
+};
+
+constexpr int ENTITY_KIND_COUNT = static_cast<int>(EntityKind::Count);
+
+constexpr bool isTankKind(EntityKind kind) {
+    return kind == EntityKind::PlayerTank || kind == EntityKind::EnemyTank;
+}
+
+/**
+ * @brief Side an entity fights for; a bullet keeps its shooter's team
+ */
+enum class Team : uint8_t {
+    Neutral = 0,
+    Player,
+    Enemy
+};
+
 /**
  * @brief Sound effect IDs
  */
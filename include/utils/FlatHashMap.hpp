@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace tank {
+
+/**
+ * @brief Open-addressing hash map kept in one flat array
+ *
+ * Linear probing with backward-shift erase, so there are no tombstones and
+ * no per-entry nodes: inserting and erasing reuse the table and only growing
+ * past half full allocates. Meant for small keys of short-lived entities
+ * (ids) that come and go every few ticks. Inserting or erasing may move
+ * entries, so pointers and references returned by find() or operator[] are
+ * only valid until the next insert or erase.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatHashMap {
+public:
+    explicit FlatHashMap(std::size_t capacity = 16) { rehash(capacity); }
+
+    Value* find(const Key& key) {
+        const std::size_t index = findIndex(key);
+        return index == NOT_FOUND ? nullptr : &slots_[index].value;
+    }
+    const Value* find(const Key& key) const {
+        const std::size_t index = findIndex(key);
+        return index == NOT_FOUND ? nullptr : &slots_[index].value;
+    }
+
+    // Inserts a default value if the key is missing
+    Value& operator[](const Key& key) {
+        if ((size_ + 1) * 2 > slots_.size()) {
+            rehash(slots_.size() * 2);
+        }
+        std::size_t index = home(key);
+        while (slots_[index].used) {
+            if (slots_[index].key == key) {
+                return slots_[index].value;
+            }
+            index = (index + 1) & mask_;
+        }
+        slots_[index].key = key;
+        slots_[index].value = Value();
+        slots_[index].used = true;
+        ++size_;
+        return slots_[index].value;
+    }
+
+    bool erase(const Key& key) {
+        const std::size_t index = findIndex(key);
+        if (index == NOT_FOUND) {
+            return false;
+        }
+        eraseAt(index);
+        return true;
+    }
+
+    // Erases every entry for which remove(key, value) returns true
+    template<typename Predicate>
+    void eraseIf(Predicate&& remove) {
+        // A backward shift only fills the hole at i from further along the
+        // probe chain (wrapping entries are checked again), so i is checked
+        // again before moving on
+        for (std::size_t i = 0; i < slots_.size();) {
+            if (slots_[i].used && remove(slots_[i].key, slots_[i].value)) {
+                eraseAt(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    template<typename Visit>
+    void forEach(Visit&& visit) {
+        for (Slot& slot : slots_) {
+            if (slot.used) {
+                visit(slot.key, slot.value);
+            }
+        }
+    }
+
+    void clear() {
+        for (Slot& slot : slots_) {
+            slot.used = false;
+        }
+        size_ = 0;
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    struct Slot {
+        Key key{};
+        Value value{};
+        bool used = false;
+    };
+
+    static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+    // Fibonacci hashing spreads sequential ids and packed keys alike
+    std::size_t home(const Key& key) const {
+        const auto hash = static_cast<std::uint64_t>(Hash{}(key));
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    std::size_t findIndex(const Key& key) const {
+        for (std::size_t index = home(key); slots_[index].used; index = (index + 1) & mask_) {
+            if (slots_[index].key == key) {
+                return index;
+            }
+        }
+        return NOT_FOUND;
+    }
+
+    void eraseAt(std::size_t hole) {
+        // Pull later entries of the probe chain back so lookups never stop
+        // early at the hole
+        for (std::size_t next = (hole + 1) & mask_; slots_[next].used; next = (next + 1) & mask_) {
+            const std::size_t wanted = home(slots_[next].key);
+            // Movable if its home is not cyclically within (hole, next]
+            if (((next - wanted) & mask_) >= ((next - hole) & mask_)) {
+                slots_[hole] = std::move(slots_[next]);
+                hole = next;
+            }
+        }
+        slots_[hole].used = false;
+        --size_;
+    }
+
+    void rehash(std::size_t capacity) {
+        std::size_t size = 2;
+        unsigned bits = 1;
+        while (size < capacity) {
+            size *= 2;
+            ++bits;
+        }
+        std::vector<Slot> old(size);
+        old.swap(slots_);
+        mask_ = size - 1;
+        shift_ = 64 - bits;
+        size_ = 0;
+        for (Slot& slot : old) {
+            if (slot.used) {
+                (*this)[slot.key] = std::move(slot.value);
+            }
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::size_t mask_ = 0;
+    unsigned shift_ = 63;
+    std::size_t size_ = 0;
+};
+
+} // namespace tank
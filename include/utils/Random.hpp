@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace tank {
+
+/**
+ * @brief Small counter-based random stream
+ *
+ * Draw n is a SplitMix64 hash of (key, n), so the whole state is a key and a
+ * counter (16 bytes instead of mt19937's ~5 KB). Streams with different keys
+ * are independent, and the bounded helpers below are implemented here rather
+ * than via <random> distributions, so a seed yields the same sequence on
+ * every standard library. Satisfies UniformRandomBitGenerator.
+ */
+class RandomStream {
+public:
+    using result_type = uint32_t;
+
+    RandomStream() = default;
+    explicit RandomStream(uint64_t key) : key_(key) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return static_cast<result_type>(next64() >> 32); }
+
+    uint64_t next64() {
+        ++counter_;
+        return mix(key_ + counter_ * GOLDEN_GAMMA);
+    }
+
+    // Uniform integer in [minValue, maxValue] (Lemire's multiply-shift with
+    // rejection, so there is no modulo bias).
+    int nextInt(int minValue, int maxValue) {
+        if (maxValue <= minValue) {
+            return minValue;
+        }
+        const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(maxValue) - minValue) + 1;
+        const uint64_t threshold = (uint64_t{1} << 32) % range;
+        uint64_t product = static_cast<uint64_t>((*this)()) * range;
+        while ((product & 0xFFFFFFFFull) < threshold) {
+            product = static_cast<uint64_t>((*this)()) * range;
+        }
+        return minValue + static_cast<int>(product >> 32);
+    }
+
+    // Uniform float in [0, 1)
+    float nextFloat() {
+        return static_cast<float>((*this)() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Index in [0, count) picked with probability weights[i] / sum(weights).
+    // Non-positive weights are never picked; returns 0 if all are.
+    size_t nextWeighted(const int* weights, size_t count) {
+        int total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += weights[i] > 0 ? weights[i] : 0;
+        }
+        if (total <= 0) {
+            return 0;
+        }
+
+        int roll = nextInt(0, total - 1);
+        for (size_t i = 0; i < count; ++i) {
+            if (weights[i] <= 0) {
+                continue;
+            }
+            if (roll < weights[i]) {
+                return i;
+            }
+            roll -= weights[i];
+        }
+        return count - 1;
+    }
+
+    template <size_t N>
+    size_t nextWeighted(const int (&weights)[N]) {
+        return nextWeighted(weights, N);
+    }
+
+    uint64_t getKey() const { return key_; }
+    uint64_t getCounter() const { return counter_; }
+
+    static uint64_t mix(uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+    uint64_t key_ = 0;
+    uint64_t counter_ = 0;
+};
+
+/**
+ * @brief Seedable random source for one game world
+ *
+ * Hands out independent per-entity streams in creation order, so a seed
+ * reproduces a whole match without any process-wide generator.
+ */
+class WorldRandom {
+public:
+    explicit WorldRandom(uint64_t seed = 0) { reseed(seed); }
+
+    void reseed(uint64_t seed) {
+        seed_ = seed;
+        streamsIssued_ = 0;
+        world_ = createStream();
+    }
+
+    uint64_t getSeed() const { return seed_; }
+
+    // New independent stream, e.g. for an enemy's AI
+    RandomStream createStream() {
+        ++streamsIssued_;
+        return RandomStream(RandomStream::mix(seed_ ^ RandomStream::mix(streamsIssued_)));
+    }
+
+    // Stream for world-level draws (power-up drops, ...)
+    RandomStream& world() { return world_; }
+
+private:
+    uint64_t seed_ = 0;
+    uint64_t streamsIssued_ = 0;
+    RandomStream world_;
+};
+
+} // namespace tank
@@ -91,6 +91,12 @@ struct Rectangle {
         return {x + offset.x, y + offset.y, width, height};
     }
 
+    // Area covered while moving by offset (start and end boxes included)
+    [[nodiscard]] Rectangle swept(const Vector2& offset) const {
+        return {std::min(x, x + offset.x), std::min(y, y + offset.y),
+                width + std::abs(offset.x), height + std::abs(offset.y)};
+    }
+
     // Comparison
     constexpr bool operator==(const Rectangle& other) const {
         return x == other.x && y == other.y &&
@@ -0,0 +1,14 @@
+#pragma once
+
+// Intrinsics for the SIMD kernels; include from kernel sources only. SSE2 is
+// part of the x86-64 baseline. AVX2 code is compiled per function with
+// TANK_TARGET_AVX2 and must only run once isSimdLevelSupported() says so.
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TANK_SIMD_SSE2 1
+#if defined(__GNUC__) || defined(__clang__)
+#include <immintrin.h>
+#define TANK_SIMD_AVX2 1
+#define TANK_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace tank {
+
+/**
+ * @brief Instruction set a SIMD kernel is written for
+ *
+ * Shared by the runtime-dispatched kernel families (BoxBatch,
+ * OccupancyBitmap), so CPU detection and the fallback order live in one
+ * place.
+ */
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+// Compiled in and supported by this CPU
+bool isSimdLevelSupported(SimdLevel level);
+// Best level isSimdLevelSupported() accepts
+SimdLevel detectSimdLevel();
+const char* getSimdLevelName(SimdLevel level);
+
+} // namespace tank
@@ -86,6 +86,19 @@ struct Vector2 {
         return (*this - other).length();
     }
 
+    static constexpr Vector2 lerp(const Vector2& from, const Vector2& to, float t) {
+        return {from.x + (to.x - from.x) * t, from.y + (to.y - from.y) * t};
+    }
+
+    // Render position between two ticks. Jumps longer than maxDistance are
+    // teleports (spawn, respawn) and snap instead of sliding across the map.
+    static Vector2 interpolate(const Vector2& from, const Vector2& to, float alpha, float maxDistance) {
+        if ((to - from).lengthSquared() > maxDistance * maxDistance) {
+            return to;
+        }
+        return lerp(from, to, alpha);
+    }
+
     // Static constants
     static constexpr Vector2 zero() { return {0.0f, 0.0f}; }
     static constexpr Vector2 one() { return {1.0f, 1.0f}; }
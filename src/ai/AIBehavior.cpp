@@ -1,6 +1,6 @@
 #include "ai/AIBehavior.hpp"
 #include "entities/tanks/EnemyTank.hpp"
-#include "level/Level.hpp"
+#include "entities/terrain/TerrainMap.hpp"
 #include <ctime>
 #include <climits>
 #include <algorithm>
@@ -21,10 +21,15 @@ Direction directionTowards(const Vector2& from, const Vector2& target) {
 
 // SimpleAI implementation
 SimpleAI::SimpleAI()
+    : SimpleAI(RandomStream(static_cast<uint64_t>(std::time(nullptr))))
+{
+}
+
+SimpleAI::SimpleAI(RandomStream random)
     : directionTimer_(0.0f)
     , fireTimer_(0.0f)
     , currentDirection_(Direction::Down)
-    , rng_(static_cast<unsigned>(std::time(nullptr)))
+    , rng_(random)
 {
 }
 
@@ -49,17 +54,21 @@ void SimpleAI::update(EnemyTank& enemy, float deltaTime) {
 }
 
 Direction SimpleAI::getRandomDirection() {
-    std::uniform_int_distribution<int> dist(0, 3);
-    return static_cast<Direction>(dist(rng_));
+    return static_cast<Direction>(rng_.nextInt(0, 3));
 }
 
 // PathfindingAI implementation
 PathfindingAI::PathfindingAI()
-    : level_(nullptr)
+    : PathfindingAI(RandomStream(static_cast<uint64_t>(std::time(nullptr))))
+{
+}
+
+PathfindingAI::PathfindingAI(RandomStream random)
+    : terrain_(nullptr)
     , currentPathIndex_(0)
     , pathUpdateTimer_(0.0f)
     , fireTimer_(0.0f)
-    , rng_(static_cast<unsigned>(std::time(nullptr)))
+    , rng_(random)
 {
 }
 
@@ -91,8 +100,7 @@ void PathfindingAI::update(EnemyTank& enemy, float deltaTime) {
         }
     } else {
         // No path or reached end, move randomly
-        std::uniform_int_distribution<int> dist(0, 3);
-        enemy.move(static_cast<Direction>(dist(rng_)));
+        enemy.move(static_cast<Direction>(rng_.nextInt(0, 3)));
     }
 
     // Fire periodically
@@ -103,7 +111,7 @@ void PathfindingAI::update(EnemyTank& enemy, float deltaTime) {
 }
 
 void PathfindingAI::calculatePath(EnemyTank& enemy) {
-    if (!level_) return;
+    if (!terrain_) return;
 
     path_.clear();
     currentPathIndex_ = 0;
@@ -179,11 +187,9 @@ void PathfindingAI::calculatePath(EnemyTank& enemy) {
 }
 
 bool PathfindingAI::isPassable(int x, int y) const {
-    if (!level_) return false;
+    if (!terrain_) return false;
     if (x < 0 || x >= GRID_SIZE || y < 0 || y >= GRID_SIZE) return false;
 
-    const auto& terrainMap = level_->getTerrainMap();
-
     // Check 2x2 tiles (tank size)
     for (int dy = 0; dy < 2; ++dy) {
         for (int dx = 0; dx < 2; ++dx) {
@@ -191,9 +197,9 @@ bool PathfindingAI::isPassable(int x, int y) const {
             int ty = y + dy;
             if (tx >= GRID_SIZE || ty >= GRID_SIZE) continue;
 
-            TerrainType type = terrainMap[ty][tx];
-            // Steel and water block tanks
-            if (type == TerrainType::Steel || type == TerrainType::Water) {
+            // Walls a basic bullet cannot clear (steel, water) block the path
+            const TerrainMaterial& material = getTerrainMaterial(terrain_->get(tx, ty));
+            if (material.blocksTanks && !material.isBrokenByBasicShot()) {
                 return false;
             }
         }
@@ -0,0 +1,183 @@
+#include "collision/BoxBatch.hpp"
+#include "utils/SimdIntrinsics.hpp"
+#include <atomic>
+#include <limits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace tank {
+
+namespace {
+
+// Edge columns and the query's edges (left, top, right, bottom)
+struct Columns {
+    const float* left;
+    const float* top;
+    const float* right;
+    const float* bottom;
+};
+
+using BlockKernel = std::uint64_t (*)(const Columns& boxes, std::size_t count, const float* query);
+
+std::uint64_t testScalar(const Columns& boxes, std::size_t count, const float* query) {
+    std::uint64_t hits = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool overlap = boxes.left[i] < query[2] && boxes.right[i] > query[0] &&
+                             boxes.top[i] < query[3] && boxes.bottom[i] > query[1];
+        hits |= static_cast<std::uint64_t>(overlap) << i;
+    }
+    return hits;
+}
+
+#ifdef TANK_SIMD_SSE2
+std::uint64_t testSSE2(const Columns& boxes, std::size_t count, const float* query) {
+    const __m128 qLeft = _mm_set1_ps(query[0]);
+    const __m128 qTop = _mm_set1_ps(query[1]);
+    const __m128 qRight = _mm_set1_ps(query[2]);
+    const __m128 qBottom = _mm_set1_ps(query[3]);
+    std::uint64_t hits = 0;
+    for (std::size_t i = 0; i < count; i += 4) {
+        const __m128 x = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(boxes.left + i), qRight),
+                                    _mm_cmpgt_ps(_mm_loadu_ps(boxes.right + i), qLeft));
+        const __m128 y = _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(boxes.top + i), qBottom),
+                                    _mm_cmpgt_ps(_mm_loadu_ps(boxes.bottom + i), qTop));
+        hits |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_and_ps(x, y))) << i;
+    }
+    return hits;
+}
+#endif
+
+#ifdef TANK_SIMD_AVX2
+TANK_TARGET_AVX2 std::uint64_t testAVX2(const Columns& boxes, std::size_t count, const float* query) {
+    const __m256 qLeft = _mm256_set1_ps(query[0]);
+    const __m256 qTop = _mm256_set1_ps(query[1]);
+    const __m256 qRight = _mm256_set1_ps(query[2]);
+    const __m256 qBottom = _mm256_set1_ps(query[3]);
+    std::uint64_t hits = 0;
+    for (std::size_t i = 0; i < count; i += 8) {
+        const __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(boxes.left + i), qRight, _CMP_LT_OQ),
+                                       _mm256_cmp_ps(_mm256_loadu_ps(boxes.right + i), qLeft, _CMP_GT_OQ));
+        const __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(boxes.top + i), qBottom, _CMP_LT_OQ),
+                                       _mm256_cmp_ps(_mm256_loadu_ps(boxes.bottom + i), qTop, _CMP_GT_OQ));
+        hits |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_and_ps(x, y))) << i;
+    }
+    return hits;
+}
+#endif
+
+BlockKernel kernelFunction(BoxKernel kernel) {
+    switch (kernel) {
+#ifdef TANK_SIMD_AVX2
+        case BoxKernel::AVX2:
+            return testAVX2;
+#endif
+#ifdef TANK_SIMD_SSE2
+        case BoxKernel::SSE2:
+            return testSSE2;
+#endif
+        default:
+            return testScalar;
+    }
+}
+
+// The kernel is one atomic enum, so a sweep on a contact worker never sees
+// a half-written switch from setKernel(). Resolved on first use, so it is
+// safe from other static initializers.
+std::atomic<BoxKernel>& activeKernel() {
+    static std::atomic<BoxKernel> active{detectSimdLevel()};
+    return active;
+}
+
+// Overlaps nothing: its left edge is past every right edge
+constexpr float EMPTY_LEFT = std::numeric_limits<float>::infinity();
+constexpr float EMPTY_RIGHT = -std::numeric_limits<float>::infinity();
+
+} // namespace
+
+BoxBatch::BoxBatch() {
+    clear();
+}
+
+void BoxBatch::clear() {
+    size_ = 0;
+    left_.assign(PADDING, EMPTY_LEFT);
+    top_.assign(PADDING, EMPTY_LEFT);
+    right_.assign(PADDING, EMPTY_RIGHT);
+    bottom_.assign(PADDING, EMPTY_RIGHT);
+}
+
+void BoxBatch::reserve(std::size_t count) {
+    left_.reserve(count + PADDING);
+    top_.reserve(count + PADDING);
+    right_.reserve(count + PADDING);
+    bottom_.reserve(count + PADDING);
+}
+
+std::size_t BoxBatch::add(const Rectangle& box) {
+    // The new box takes the first padding slot; the tail grows by one
+    left_.push_back(EMPTY_LEFT);
+    top_.push_back(EMPTY_LEFT);
+    right_.push_back(EMPTY_RIGHT);
+    bottom_.push_back(EMPTY_RIGHT);
+    left_[size_] = box.left();
+    top_[size_] = box.top();
+    right_[size_] = box.right();
+    bottom_[size_] = box.bottom();
+    return size_++;
+}
+
+std::uint64_t BoxBatch::testBlock(const Rectangle& query, std::size_t begin, std::size_t count) const {
+    const Columns boxes{left_.data() + begin, top_.data() + begin, right_.data() + begin, bottom_.data() + begin};
+    const float edges[4] = {query.left(), query.top(), query.right(), query.bottom()};
+    const BlockKernel kernel = kernelFunction(activeKernel().load(std::memory_order_relaxed));
+    const std::uint64_t hits = kernel(boxes, count, edges);
+    // Vector kernels test whole lanes; drop bits past count
+    return count >= 64 ? hits : hits & ((std::uint64_t{1} << count) - 1);
+}
+
+void BoxBatch::intersectMask(const Rectangle& query, std::vector<std::uint64_t>& mask) const {
+    mask.assign((size_ + 63) / 64, 0);
+    for (std::size_t word = 0; word < mask.size(); ++word) {
+        const std::size_t begin = word * 64;
+        mask[word] = testBlock(query, begin, size_ - begin < 64 ? size_ - begin : 64);
+    }
+}
+
+bool BoxBatch::anyIntersects(const Rectangle& query) const {
+    for (std::size_t begin = 0; begin < size_; begin += 64) {
+        if (testBlock(query, begin, size_ - begin < 64 ? size_ - begin : 64)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int BoxBatch::lowestBit(std::uint64_t bits) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+BoxKernel BoxBatch::getKernel() {
+    return activeKernel().load(std::memory_order_relaxed);
+}
+
+bool BoxBatch::setKernel(BoxKernel kernel) {
+    if (!isSimdLevelSupported(kernel)) {
+        return false;
+    }
+    activeKernel().store(kernel, std::memory_order_relaxed);
+    return true;
+}
+
+const char* BoxBatch::getKernelName(BoxKernel kernel) {
+    return getSimdLevelName(kernel);
+}
+
+} // namespace tank
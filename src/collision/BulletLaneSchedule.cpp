@@ -0,0 +1,51 @@
+#include "collision/BulletLaneSchedule.hpp"
+
+namespace tank {
+
+BulletLaneSchedule::Lane* BulletLaneSchedule::touch(int bulletId, std::size_t bulletIndex) {
+    Lane* found = lanes_.find(bulletId);
+    if (!found) {
+        return nullptr;
+    }
+    found->bulletIndex = bulletIndex;
+    found->seenTick = tick_;
+    return found;
+}
+
+BulletLaneSchedule::Lane& BulletLaneSchedule::assign(int bulletId, const Lane& lane, std::int64_t dueTick) {
+    Lane& stored = lanes_[bulletId];
+    const std::uint32_t version = stored.version + 1;
+    stored = lane;
+    stored.version = version;
+    stored.seenTick = tick_;
+    stored.stale = false;
+    if (stored.target != Target::None) {
+        queue_.push({dueTick, bulletId, version});
+    }
+    return stored;
+}
+
+void BulletLaneSchedule::reschedule(int bulletId, std::int64_t dueTick) {
+    const Lane* found = lanes_.find(bulletId);
+    if (found && found->target != Target::None) {
+        queue_.push({dueTick, bulletId, found->version});
+    }
+}
+
+void BulletLaneSchedule::dropUnseen() {
+    lanes_.eraseIf([this](int, const Lane& lane) { return lane.seenTick != tick_; });
+}
+
+void BulletLaneSchedule::invalidate(const Rectangle& area) {
+    lanes_.forEach([&area](int, Lane& lane) {
+        if (!lane.stale && lane.area.intersects(area)) {
+            lane.stale = true;
+        }
+    });
+}
+
+void BulletLaneSchedule::invalidateAll() {
+    lanes_.forEach([](int, Lane& lane) { lane.stale = true; });
+}
+
+} // namespace tank
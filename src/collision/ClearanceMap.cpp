@@ -0,0 +1,74 @@
+#include "collision/ClearanceMap.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace tank {
+
+void ClearanceMap::rebuild(const OccupancyBitmap& blocked) {
+    width_ = blocked.getWidth();
+    height_ = blocked.getHeight();
+    clearance_.assign(static_cast<std::size_t>(width_) * height_, 0);
+    recompute(blocked, 0, 0, width_, height_);
+}
+
+void ClearanceMap::update(const OccupancyBitmap& blocked, const Rectangle& area) {
+    if (blocked.getWidth() != width_ || blocked.getHeight() != height_) {
+        rebuild(blocked);
+        return;
+    }
+
+    const int x1 = std::min(width_, static_cast<int>(std::ceil(area.right())));
+    const int y1 = std::min(height_, static_cast<int>(std::ceil(area.bottom())));
+    const int x0 = std::max(0, static_cast<int>(std::floor(area.left())) - MAX_CLEARANCE);
+    const int y0 = std::max(0, static_cast<int>(std::floor(area.top())) - MAX_CLEARANCE);
+    if (x0 < x1 && y0 < y1) {
+        recompute(blocked, x0, y0, x1, y1);
+    }
+}
+
+int ClearanceMap::getClearance(int x, int y) const {
+    if (x < 0 || y < 0 || x >= width_ || y >= height_) {
+        return MAX_CLEARANCE;
+    }
+    return clearance_[static_cast<std::size_t>(y) * width_ + x];
+}
+
+void ClearanceMap::recompute(const OccupancyBitmap& blocked, int x0, int y0, int x1, int y1) {
+    // Bottom-up, right to left: the right, lower and diagonal neighbours are
+    // either done this pass or outside the changed block and still valid.
+    for (int y = y1 - 1; y >= y0; --y) {
+        for (int x = x1 - 1; x >= x0; --x) {
+            int value = 0;
+            if (!blocked.test(x, y)) {
+                const int smallest = std::min({getClearance(x + 1, y), getClearance(x, y + 1),
+                                               getClearance(x + 1, y + 1)});
+                value = std::min(MAX_CLEARANCE, smallest + 1);
+            }
+            clearance_[static_cast<std::size_t>(y) * width_ + x] = static_cast<std::uint8_t>(value);
+        }
+    }
+}
+
+bool ClearanceMap::isFree(const Rectangle& box, const OccupancyBitmap& blocked) const {
+    // Pixels under the box, clipped to the map as OccupancyBitmap does
+    const int x0 = std::max(0, static_cast<int>(std::floor(box.left())));
+    const int y0 = std::max(0, static_cast<int>(std::floor(box.top())));
+    const int x1 = std::min(width_, static_cast<int>(std::ceil(box.right())));
+    const int y1 = std::min(height_, static_cast<int>(std::ceil(box.bottom())));
+    if (x1 <= x0 || y1 <= y0) {
+        return true;
+    }
+
+    const int clearance = getClearance(x0, y0);
+    const int spanX = x1 - x0;
+    const int spanY = y1 - y0;
+    if (clearance >= std::max(spanX, spanY)) {
+        return true;
+    }
+    if (clearance < std::min(spanX, spanY) && clearance < MAX_CLEARANCE) {
+        return false;
+    }
+    return !blocked.any(box);
+}
+
+} // namespace tank
@@ -1,8 +1,23 @@
 #include "collision/CollisionManager.hpp"
+#include <algorithm>
 
 namespace tank {
 
 void CollisionManager::addHandler(std::unique_ptr<ICollisionHandler> handler) {
+    // Precompute routes in the order dispatch used to probe them: this
+    // handler in argument order, then reversed, after all earlier handlers.
+    for (int i = 0; i < ENTITY_KIND_COUNT; ++i) {
+        for (int j = 0; j < ENTITY_KIND_COUNT; ++j) {
+            const auto a = static_cast<EntityKind>(i);
+            const auto b = static_cast<EntityKind>(j);
+            if (handler->canHandle(a, b)) {
+                routes_[routeIndex(a, b)].push_back({handler.get(), false});
+            }
+            if (handler->canHandle(b, a)) {
+                routes_[routeIndex(a, b)].push_back({handler.get(), true});
+            }
+        }
+    }
     handlers_.push_back(std::move(handler));
 }
 
@@ -10,18 +25,38 @@ bool CollisionManager::checkAABB(const Rectangle& a, const Rectangle& b) {
     return a.intersects(b);
 }
 
-void CollisionManager::dispatchCollision(IEntity& a, IEntity& b) {
-    for (auto& handler : handlers_) {
-        if (handler->canHandle(a, b)) {
-            if (handler->handle(a, b)) {
-                return; // Collision handled
-            }
+std::optional<float> CollisionManager::sweepAABB(const Rectangle& box, const Vector2& delta, const Rectangle& target) {
+    // Slab test: intersect the open time intervals during which the boxes
+    // overlap on each axis.
+    float first = 0.0f;
+    float last = 1.0f;
+
+    const auto axis = [&first, &last](float minA, float maxA, float minB, float maxB, float d) {
+        if (d == 0.0f) {
+            return minA < maxB && maxA > minB;
         }
-        // Try reverse order
-        if (handler->canHandle(b, a)) {
-            if (handler->handle(b, a)) {
-                return;
-            }
+        float enter = (d > 0.0f ? minB - maxA : maxB - minA) / d;
+        float exit = (d > 0.0f ? maxB - minA : minB - maxA) / d;
+        first = std::max(first, enter);
+        last = std::min(last, exit);
+        return true;
+    };
+
+    if (!axis(box.left(), box.right(), target.left(), target.right(), delta.x) ||
+        !axis(box.top(), box.bottom(), target.top(), target.bottom(), delta.y)) {
+        return std::nullopt;
+    }
+    if (first >= last || first >= 1.0f) {
+        return std::nullopt;
+    }
+    return first;
+}
+
+void CollisionManager::dispatchCollision(IEntity& a, IEntity& b) {
+    for (const Route& route : routes_[routeIndex(a.getKind(), b.getKind())]) {
+        const bool handled = route.swapped ? route.handler->handle(b, a) : route.handler->handle(a, b);
+        if (handled) {
+            return; // Collision handled
         }
     }
 }
@@ -0,0 +1,189 @@
+#include "collision/OccupancyBitmap.hpp"
+#include "utils/SimdIntrinsics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace tank {
+
+namespace {
+
+using Word = std::uint64_t;
+
+// Tests rows [0, rows) of a four-word window; mask zeroes the words (and
+// bits) outside the span.
+using RowKernel = bool (*)(const Word* row, int rows, int stride, const Word* mask);
+
+bool anyScalar(const Word* row, int rows, int stride, const Word* mask) {
+    for (int y = 0; y < rows; ++y, row += stride) {
+        if ((row[0] & mask[0]) | (row[1] & mask[1]) | (row[2] & mask[2]) | (row[3] & mask[3])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef TANK_SIMD_SSE2
+bool anySSE2(const Word* row, int rows, int stride, const Word* mask) {
+    const __m128i maskLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+    const __m128i maskHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + 2));
+    const __m128i zero = _mm_setzero_si128();
+    for (int y = 0; y < rows; ++y, row += stride) {
+        const __m128i lo = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row)), maskLo);
+        const __m128i hi = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 2)), maskHi);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(lo, hi), zero)) != 0xFFFF) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+#ifdef TANK_SIMD_AVX2
+TANK_TARGET_AVX2 bool anyAVX2(const Word* row, int rows, int stride, const Word* mask) {
+    const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask));
+    for (int y = 0; y < rows; ++y, row += stride) {
+        const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row));
+        if (!_mm256_testz_si256(words, bits)) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+RowKernel kernelFunction(OccupancyKernel kernel) {
+    switch (kernel) {
+#ifdef TANK_SIMD_AVX2
+        case OccupancyKernel::AVX2:
+            return anyAVX2;
+#endif
+#ifdef TANK_SIMD_SSE2
+        case OccupancyKernel::SSE2:
+            return anySSE2;
+#endif
+        default:
+            return anyScalar;
+    }
+}
+
+// One atomic enum, as in BoxBatch, so any() on a contact worker never sees
+// a half-written switch. Resolved on first use, so it is safe from other
+// static initializers.
+std::atomic<OccupancyKernel>& activeKernel() {
+    static std::atomic<OccupancyKernel> active{detectSimdLevel()};
+    return active;
+}
+
+// Bits [lo, hi) of a word, 0 <= lo < hi <= 64
+Word bitRange(int lo, int hi) {
+    const Word upper = hi >= 64 ? ~Word{0} : (Word{1} << hi) - 1;
+    return upper & ~((Word{1} << lo) - 1);
+}
+
+} // namespace
+
+OccupancyBitmap::OccupancyBitmap(int width, int height) {
+    reset(width, height);
+}
+
+void OccupancyBitmap::reset(int width, int height) {
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    const int rowWords = (width_ + WORD_BITS - 1) / WORD_BITS;
+    stride_ = rowWords + WINDOW_WORDS - 1;
+    words_.assign(static_cast<std::size_t>(stride_) * static_cast<std::size_t>(height_), 0);
+}
+
+void OccupancyBitmap::clear() {
+    std::fill(words_.begin(), words_.end(), 0);
+}
+
+OccupancyBitmap::PixelSpan OccupancyBitmap::spanFor(const Rectangle& area) const {
+    PixelSpan span;
+    span.x0 = std::max(0, static_cast<int>(std::floor(area.left())));
+    span.y0 = std::max(0, static_cast<int>(std::floor(area.top())));
+    span.x1 = std::min(width_, static_cast<int>(std::ceil(area.right())));
+    span.y1 = std::min(height_, static_cast<int>(std::ceil(area.bottom())));
+    return span;
+}
+
+void OccupancyBitmap::assign(const Rectangle& area, bool solid) {
+    const PixelSpan span = spanFor(area);
+    if (span.empty()) {
+        return;
+    }
+
+    const int firstWord = span.x0 / WORD_BITS;
+    const int lastWord = (span.x1 - 1) / WORD_BITS;
+    for (int y = span.y0; y < span.y1; ++y) {
+        Word* row = words_.data() + static_cast<std::size_t>(y) * stride_;
+        for (int w = firstWord; w <= lastWord; ++w) {
+            const int lo = std::max(span.x0 - w * WORD_BITS, 0);
+            const int hi = std::min(span.x1 - w * WORD_BITS, WORD_BITS);
+            const Word bits = bitRange(lo, hi);
+            row[w] = solid ? (row[w] | bits) : (row[w] & ~bits);
+        }
+    }
+}
+
+void OccupancyBitmap::fill(const Rectangle& area) {
+    assign(area, true);
+}
+
+void OccupancyBitmap::erase(const Rectangle& area) {
+    assign(area, false);
+}
+
+bool OccupancyBitmap::any(const Rectangle& area) const {
+    const PixelSpan span = spanFor(area);
+    if (span.empty()) {
+        return false;
+    }
+
+    const int firstWord = span.x0 / WORD_BITS;
+    const int lastWord = (span.x1 - 1) / WORD_BITS;
+    const Word* rows = words_.data() + static_cast<std::size_t>(span.y0) * stride_;
+    const RowKernel kernel = kernelFunction(activeKernel().load(std::memory_order_relaxed));
+
+    // Tank and bullet boxes fit in one window; wider areas take several.
+    for (int window = firstWord; window <= lastWord; window += WINDOW_WORDS) {
+        Word mask[WINDOW_WORDS] = {};
+        for (int i = 0; i < WINDOW_WORDS && window + i <= lastWord; ++i) {
+            const int w = window + i;
+            const int lo = std::max(span.x0 - w * WORD_BITS, 0);
+            const int hi = std::min(span.x1 - w * WORD_BITS, WORD_BITS);
+            mask[i] = bitRange(lo, hi);
+        }
+        if (kernel(rows + window, span.y1 - span.y0, stride_, mask)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool OccupancyBitmap::test(int x, int y) const {
+    if (x < 0 || y < 0 || x >= width_ || y >= height_) {
+        return false;
+    }
+    const Word word = words_[static_cast<std::size_t>(y) * stride_ + x / WORD_BITS];
+    return (word >> (x % WORD_BITS)) & 1u;
+}
+
+OccupancyKernel OccupancyBitmap::getKernel() {
+    return activeKernel().load(std::memory_order_relaxed);
+}
+
+bool OccupancyBitmap::setKernel(OccupancyKernel kernel) {
+    if (!isSimdLevelSupported(kernel)) {
+        return false;
+    }
+    activeKernel().store(kernel, std::memory_order_relaxed);
+    return true;
+}
+
+const char* OccupancyBitmap::getKernelName(OccupancyKernel kernel) {
+    return getSimdLevelName(kernel);
+}
+
+} // namespace tank
@@ -0,0 +1,128 @@
+#include "collision/SweepAndPrune.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace tank {
+
+SweepAndPrune::SweepAndPrune() {
+    pairFilter_.set();
+}
+
+void SweepAndPrune::setPairFilter(EntityKind a, EntityKind b, bool enabled) {
+    const auto i = static_cast<std::size_t>(a);
+    const auto j = static_cast<std::size_t>(b);
+    pairFilter_.set(i * ENTITY_KIND_COUNT + j, enabled);
+    pairFilter_.set(j * ENTITY_KIND_COUNT + i, enabled);
+}
+
+void SweepAndPrune::beginFrame() {
+    ++frame_;
+}
+
+void SweepAndPrune::submit(std::uint64_t key, EntityKind kind, int index, const Rectangle& bounds) {
+    if (const std::uint32_t* found = slotByKey_.find(key)) {
+        Proxy& proxy = proxies_[*found];
+        proxy.index = index;
+        proxy.bounds = bounds;
+        proxy.frame = frame_;
+        return;
+    }
+
+    std::uint32_t slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        proxies_[slot] = {key, kind, index, bounds, frame_};
+    } else {
+        slot = static_cast<std::uint32_t>(proxies_.size());
+        proxies_.push_back({key, kind, index, bounds, frame_});
+    }
+    slotByKey_[key] = slot;
+    // New proxies join at the end; the insertion sort moves them into place
+    order_.push_back(slot);
+}
+
+void SweepAndPrune::dropStaleProxies() {
+    order_.erase(
+        std::remove_if(order_.begin(), order_.end(),
+            [this](std::uint32_t slot) {
+                if (proxies_[slot].frame == frame_) {
+                    return false;
+                }
+                slotByKey_.erase(proxies_[slot].key);
+                freeSlots_.push_back(slot);
+                return true;
+            }),
+        order_.end()
+    );
+}
+
+void SweepAndPrune::sortByLeftEdge() {
+    lastSwapCount_ = 0;
+    for (std::size_t i = 1; i < order_.size(); ++i) {
+        const std::uint32_t slot = order_[i];
+        const float left = proxies_[slot].bounds.left();
+        std::size_t j = i;
+        while (j > 0 && proxies_[order_[j - 1]].bounds.left() > left) {
+            order_[j] = order_[j - 1];
+            --j;
+            ++lastSwapCount_;
+        }
+        order_[j] = slot;
+    }
+}
+
+void SweepAndPrune::findPairs(std::vector<Pair>& out) {
+    out.clear();
+    dropStaleProxies();
+    sortByLeftEdge();
+
+    // Edges in sweep order, so the x window and y test of each proxy run as
+    // one batch kernel call per 64 candidates
+    sorted_.clear();
+    sorted_.reserve(order_.size());
+    for (const std::uint32_t slot : order_) {
+        sorted_.add(proxies_[slot].bounds);
+    }
+
+    for (std::size_t i = 0; i < order_.size(); ++i) {
+        const Proxy& a = proxies_[order_[i]];
+
+        // Sorted: proxies from end on start at or past a's right edge
+        std::size_t end = i + 1;
+        std::size_t count = order_.size() - end;
+        while (count > 0) {
+            const std::size_t half = count / 2;
+            if (sorted_.getLeft(end + half) < a.bounds.right()) {
+                end += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+
+        sorted_.forEachIntersecting(a.bounds, i + 1, end, [&](std::size_t j) {
+            const Proxy& b = proxies_[order_[j]];
+            if (!pairFilter_.test(static_cast<std::size_t>(a.kind) * ENTITY_KIND_COUNT +
+                                  static_cast<std::size_t>(b.kind))) {
+                return;
+            }
+
+            Pair pair{a.kind, a.index, b.kind, b.index};
+            if (pair.kindB < pair.kindA || (pair.kindA == pair.kindB && pair.indexB < pair.indexA)) {
+                std::swap(pair.kindA, pair.kindB);
+                std::swap(pair.indexA, pair.indexB);
+            }
+            out.push_back(pair);
+        });
+    }
+
+    std::sort(out.begin(), out.end(), [](const Pair& l, const Pair& r) {
+        if (l.kindA != r.kindA) return l.kindA < r.kindA;
+        if (l.indexA != r.indexA) return l.indexA < r.indexA;
+        if (l.kindB != r.kindB) return l.kindB < r.kindB;
+        return l.indexB < r.indexB;
+    });
+}
+
+} // namespace tank
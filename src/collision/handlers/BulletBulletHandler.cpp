@@ -2,17 +2,14 @@
 
 namespace tank {
 
-bool BulletBulletHandler::canHandle(IEntity& a, IEntity& b) const {
-    Bullet* bulletA = dynamic_cast<Bullet*>(&a);
-    Bullet* bulletB = dynamic_cast<Bullet*>(&b);
-    return bulletA != nullptr && bulletB != nullptr;
+bool BulletBulletHandler::canHandle(EntityKind a, EntityKind b) const {
+    return a == EntityKind::Bullet && b == EntityKind::Bullet;
 }
 
 bool BulletBulletHandler::handle(IEntity& a, IEntity& b) {
-    Bullet* bulletA = dynamic_cast<Bullet*>(&a);
-    Bullet* bulletB = dynamic_cast<Bullet*>(&b);
+    auto* bulletA = static_cast<Bullet*>(&a);
+    auto* bulletB = static_cast<Bullet*>(&b);
 
-    if (!bulletA || !bulletB) return false;
     if (!bulletA->isAlive() || !bulletB->isAlive()) return false;
 
     // Both bullets destroy each other
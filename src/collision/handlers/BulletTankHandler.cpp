@@ -2,33 +2,30 @@
 
 namespace tank {
 
-bool BulletTankHandler::canHandle(IEntity& a, IEntity& b) const {
-    Bullet* bullet = dynamic_cast<Bullet*>(&a);
-    ITank* tank = dynamic_cast<ITank*>(&b);
-    return bullet != nullptr && tank != nullptr;
+bool BulletTankHandler::canHandle(EntityKind a, EntityKind b) const {
+    return a == EntityKind::Bullet && isTankKind(b);
 }
 
 bool BulletTankHandler::handle(IEntity& a, IEntity& b) {
-    Bullet* bullet = dynamic_cast<Bullet*>(&a);
-    ITank* tank = dynamic_cast<ITank*>(&b);
+    auto* bullet = static_cast<Bullet*>(&a);
+    auto* tank = static_cast<ITank*>(&b);
 
-    if (!bullet || !tank) return false;
     if (!bullet->isAlive() || !tank->isAlive()) return false;
 
     // Don't hit owner
-    if (bullet->getOwner() == tank) return false;
+    if (bullet->getOwnerHandle() == tank->getHandle()) return false;
 
     // Check friendly fire (player bullets shouldn't hit players, enemy bullets shouldn't hit enemies)
-    bool bulletFromPlayer = dynamic_cast<PlayerTank*>(bullet->getOwner()) != nullptr;
-    bool targetIsPlayer = dynamic_cast<PlayerTank*>(tank) != nullptr;
+    bool bulletFromPlayer = bullet->getTeam() == Team::Player;
+    bool targetIsPlayer = tank->getTeam() == Team::Player;
 
     if (bulletFromPlayer == targetIsPlayer) {
         return false; // Friendly fire disabled
     }
 
     // Check invincibility for players
-    if (auto* player = dynamic_cast<PlayerTank*>(tank)) {
-        if (player->isInvincible()) {
+    if (tank->getKind() == EntityKind::PlayerTank) {
+        if (static_cast<PlayerTank*>(tank)->isInvincible()) {
             bullet->die();
             return true;
         }
@@ -2,17 +2,14 @@
 
 namespace tank {
 
-bool TankTankHandler::canHandle(IEntity& a, IEntity& b) const {
-    ITank* tankA = dynamic_cast<ITank*>(&a);
-    ITank* tankB = dynamic_cast<ITank*>(&b);
-    return tankA != nullptr && tankB != nullptr;
+bool TankTankHandler::canHandle(EntityKind a, EntityKind b) const {
+    return isTankKind(a) && isTankKind(b);
 }
 
 bool TankTankHandler::handle(IEntity& a, IEntity& b) {
-    Tank* tankA = dynamic_cast<Tank*>(&a);
-    Tank* tankB = dynamic_cast<Tank*>(&b);
+    auto* tankA = static_cast<Tank*>(&a);
+    auto* tankB = static_cast<Tank*>(&b);
 
-    if (!tankA || !tankB) return false;
     if (!tankA->isAlive() || !tankB->isAlive()) return false;
 
     separateTanks(*tankA, *tankB);
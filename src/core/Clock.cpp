@@ -0,0 +1,27 @@
+#include "core/Clock.hpp"
+#include <thread>
+
+namespace tank {
+
+SystemClock::SystemClock()
+    : origin_(std::chrono::steady_clock::now())
+{
+}
+
+double SystemClock::now() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - origin_).count();
+}
+
+void SystemClock::sleepFor(double seconds) {
+    if (seconds > 0.0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    }
+}
+
+void SystemClock::spinUntil(double deadline) {
+    while (now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace tank
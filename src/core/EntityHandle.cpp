@@ -0,0 +1,40 @@
+#include "core/EntityHandle.hpp"
+
+namespace tank {
+
+EntityHandle EntityHandleTable::create(IEntity* entity) {
+    std::uint32_t index;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+    slots_[index].entity = entity;
+    ++liveCount_;
+    return EntityHandle{index, slots_[index].generation};
+}
+
+void EntityHandleTable::destroy(EntityHandle handle) {
+    if (handle.index >= slots_.size() || slots_[handle.index].generation != handle.generation) {
+        return;
+    }
+    Slot& slot = slots_[handle.index];
+    slot.entity = nullptr;
+    // Generation 0 is reserved for the null handle
+    if (++slot.generation == 0) {
+        slot.generation = 1;
+    }
+    freeSlots_.push_back(handle.index);
+    --liveCount_;
+}
+
+IEntity* EntityHandleTable::get(EntityHandle handle) const {
+    if (handle.index >= slots_.size() || slots_[handle.index].generation != handle.generation) {
+        return nullptr;
+    }
+    return slots_[handle.index].entity;
+}
+
+} // namespace tank
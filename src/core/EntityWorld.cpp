@@ -0,0 +1,19 @@
+#include "core/EntityWorld.hpp"
+#include "entities/effects/Effect.hpp"
+#include "entities/powerups/PowerUp.hpp"
+#include "entities/projectiles/Bullet.hpp"
+#include <algorithm>
+
+namespace tank {
+
+EntityWorld::EntityWorld()
+    : bulletPool_(sizeof(Bullet), Bullet::POOL_CAPACITY)
+    // One slot size fits every effect type
+    , effectPool_(std::max({sizeof(SpawnEffect), sizeof(BulletExplosion), sizeof(TankExplosion),
+                            sizeof(InvincibilityEffect), sizeof(ScorePopup)}),
+                  Effect::POOL_CAPACITY)
+    , powerUpPool_(sizeof(PowerUp), PowerUp::POOL_CAPACITY)
+{
+}
+
+} // namespace tank
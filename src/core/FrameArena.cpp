@@ -0,0 +1,71 @@
+#include "core/FrameArena.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace tank {
+
+FrameArena::FrameArena(std::size_t blockSize)
+    : blockSize_(std::max<std::size_t>(blockSize, 64)) {
+    addBlock(blockSize_);
+}
+
+void FrameArena::addBlock(std::size_t size) {
+    blocks_.push_back({std::make_unique<unsigned char[]>(size), size});
+}
+
+void* FrameArena::allocate(std::size_t bytes, std::size_t alignment) {
+    if (bytes == 0) {
+        bytes = 1;
+    }
+    for (;;) {
+        Block& block = blocks_[current_];
+        const auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+        const std::uintptr_t aligned = (base + offset_ + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+        const std::size_t begin = static_cast<std::size_t>(aligned - base);
+        if (begin + bytes <= block.size) {
+            offset_ = begin + bytes;
+            return block.data.get() + begin;
+        }
+
+        // Move on to the next block, adding one large enough if none is left
+        previousBlocksUsed_ += offset_;
+        offset_ = 0;
+        ++current_;
+        if (current_ == blocks_.size()) {
+            addBlock(std::max(blockSize_, bytes + alignment));
+        }
+    }
+}
+
+void FrameArena::deallocate(void* pointer, std::size_t bytes) {
+    // Only the newest allocation can be handed back
+    unsigned char* top = blocks_[current_].data.get() + offset_;
+    if (static_cast<unsigned char*>(pointer) + bytes == top) {
+        offset_ -= bytes;
+    }
+}
+
+void FrameArena::reset() {
+    if (blocks_.size() > 1) {
+        const std::size_t total = getCapacity();
+        blocks_.clear();
+        addBlock(total);
+    }
+    current_ = 0;
+    offset_ = 0;
+    previousBlocksUsed_ = 0;
+}
+
+std::size_t FrameArena::getBytesUsed() const {
+    return previousBlocksUsed_ + offset_;
+}
+
+std::size_t FrameArena::getCapacity() const {
+    std::size_t total = 0;
+    for (const Block& block : blocks_) {
+        total += block.size;
+    }
+    return total;
+}
+
+} // namespace tank
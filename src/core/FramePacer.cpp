@@ -0,0 +1,128 @@
+#include "core/FramePacer.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace tank {
+
+// LatencyTracker implementation
+void LatencyTracker::addSample(double seconds) {
+    samples_[next_] = seconds;
+    next_ = (next_ + 1) % CAPACITY;
+    count_ = std::min(count_ + 1, CAPACITY);
+    latest_ = seconds;
+}
+
+void LatencyTracker::reset() {
+    next_ = 0;
+    count_ = 0;
+    latest_ = 0.0;
+}
+
+double LatencyTracker::getAverage() const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (size_t i = 0; i < count_; ++i) {
+        sum += samples_[i];
+    }
+    return sum / static_cast<double>(count_);
+}
+
+double LatencyTracker::getMax() const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    return *std::max_element(samples_.begin(), samples_.begin() + count_);
+}
+
+double LatencyTracker::getPercentile(double percentile) const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    std::array<double, CAPACITY> sorted = samples_;
+    std::sort(sorted.begin(), sorted.begin() + count_);
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const size_t index = static_cast<size_t>(clamped / 100.0 * static_cast<double>(count_ - 1) + 0.5);
+    return sorted[index];
+}
+
+// FramePacer implementation
+FramePacer::FramePacer(PacingMode mode, double targetFps, std::shared_ptr<IClock> clock)
+    : mode_(mode)
+{
+    setTargetFps(targetFps);
+    setClock(std::move(clock));
+}
+
+void FramePacer::setClock(std::shared_ptr<IClock> clock) {
+    clock_ = clock ? std::move(clock) : std::make_shared<SystemClock>();
+    nextDeadline_ = 0.0;
+    inputSampledAt_ = -1.0;
+    lastPresentAt_ = -1.0;
+}
+
+void FramePacer::setTargetFps(double fps) {
+    targetFps_ = fps > 1.0 ? fps : Constants::TARGET_FPS;
+    periodSeconds_ = 1.0 / targetFps_;
+}
+
+void FramePacer::markInputSampled() {
+    inputSampledAt_ = now();
+}
+
+void FramePacer::markPresented() {
+    const double presentedAt = now();
+    if (inputSampledAt_ >= 0.0) {
+        inputLatency_.addSample(presentedAt - inputSampledAt_);
+        inputSampledAt_ = -1.0;
+    }
+    if (lastPresentAt_ >= 0.0) {
+        frameTimes_.addSample(presentedAt - lastPresentAt_);
+    }
+    lastPresentAt_ = presentedAt;
+}
+
+void FramePacer::waitForNextFrame() {
+    if (mode_ != PacingMode::Limiter) {
+        return;
+    }
+
+    const double current = now();
+    nextDeadline_ += periodSeconds_;
+    // After a hitch (or on the first frame) start a fresh schedule instead of
+    // racing through frames to catch up.
+    if (nextDeadline_ < current - periodSeconds_ || nextDeadline_ > current + periodSeconds_) {
+        nextDeadline_ = current + periodSeconds_;
+    }
+
+    const double remaining = nextDeadline_ - current;
+    if (remaining > SPIN_THRESHOLD_SECONDS) {
+        clock_->sleepFor(remaining - SPIN_THRESHOLD_SECONDS);
+    }
+    clock_->spinUntil(nextDeadline_);
+}
+
+const char* FramePacer::modeName(PacingMode mode) {
+    switch (mode) {
+        case PacingMode::VSync: return "vsync";
+        case PacingMode::Limiter: return "limit";
+        case PacingMode::Uncapped: return "uncapped";
+    }
+    return "vsync";
+}
+
+bool FramePacer::parseMode(const std::string& text, PacingMode& mode) {
+    if (text == "vsync") {
+        mode = PacingMode::VSync;
+    } else if (text == "limit" || text == "limiter") {
+        mode = PacingMode::Limiter;
+    } else if (text == "uncapped") {
+        mode = PacingMode::Uncapped;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace tank
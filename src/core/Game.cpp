@@ -1,7 +1,9 @@
 #include "core/Game.hpp"
-#include "core/ServiceLocator.hpp"
 #include "states/MenuState.hpp"
-#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
 #include <iostream>
 
 namespace tank {
@@ -12,6 +14,16 @@ Game::~Game() {
     shutdown();
 }
 
+void Game::setClock(std::shared_ptr<IClock> clock) {
+    framePacer_.setClock(std::move(clock));
+    previousTime_ = framePacer_.now();
+}
+
+void Game::setPacing(PacingMode mode, double targetFps) {
+    framePacer_.setMode(mode);
+    framePacer_.setTargetFps(targetFps);
+}
+
 bool Game::initialize() {
     std::cout << "Initializing Tank Game..." << std::endl;
 
@@ -29,7 +41,7 @@ bool Game::initialize() {
     loadInitialState();
 
     running_ = true;
-    previousTime_ = SDL_GetTicks();
+    previousTime_ = framePacer_.now();
 
     std::cout << "Game initialized successfully!" << std::endl;
     return true;
@@ -37,7 +49,8 @@ bool Game::initialize() {
 
 bool Game::initializeRenderer() {
     renderer_ = std::make_shared<SDLRenderer>();
-    if (!renderer_->initialize(
+    renderer_->setVSyncEnabled(framePacer_.getMode() == PacingMode::VSync);
+    if (!renderer_->createWindow(
             Constants::WINDOW_TITLE,
             Constants::WINDOW_WIDTH,
             Constants::WINDOW_HEIGHT)) {
@@ -45,8 +58,35 @@ bool Game::initializeRenderer() {
         return false;
     }
 
-    // Load sprite sheet
-    renderer_->setSpriteSheet(Constants::Paths::SPRITE_SHEET);
+    if (renderThreadEnabled_) {
+        // The SDL renderer is created, used and destroyed on the render thread;
+        // the window stays here with the event pump.
+        std::shared_ptr<SDLRenderer> backend = renderer_;
+        renderThread_ = std::make_unique<RenderThread>(*renderer_);
+        if (!renderThread_->start([backend]() { return backend->createRenderer(); },
+                                  [backend]() { backend->destroyRenderer(); })) {
+            std::cerr << "Failed to initialize renderer" << std::endl;
+            renderThread_.reset();
+            return false;
+        }
+        recorder_ = std::make_shared<RecordingRenderer>(*renderer_, [this](RenderCommandList& frame) {
+            renderThread_->submit(frame);
+        });
+    } else if (!renderer_->createRenderer()) {
+        std::cerr << "Failed to initialize renderer" << std::endl;
+        return false;
+    }
+    std::cout << "Render thread: " << (renderThread_ ? "on" : "off") << std::endl;
+
+    // Without working vsync the loop would spin flat out; pace it ourselves.
+    if (framePacer_.getMode() == PacingMode::VSync && !renderer_->isVSyncActive()) {
+        std::cout << "VSync unavailable; using the frame limiter instead" << std::endl;
+        framePacer_.setMode(PacingMode::Limiter);
+    }
+    std::cout << "Frame pacing: " << FramePacer::modeName(framePacer_.getMode()) << std::endl;
+
+    // Load sprite sheet (recorded into the first frame when threaded)
+    frameRenderer().setSpriteSheet(Constants::Paths::SPRITE_SHEET);
     std::cout << "Sprite sheet loaded: " << Constants::Paths::SPRITE_SHEET << std::endl;
 
     return true;
@@ -75,11 +115,9 @@ bool Game::initializeAudio() {
 }
 
 void Game::initializeServices() {
-    ServiceLocator::provide(renderer_);
-    ServiceLocator::provide(inputManager_);
-    if (audioPlayer_) {
-        ServiceLocator::provide(audioPlayer_);
-    }
+    // audioPlayer_ may be null; the context then treats audio as absent.
+    std::shared_ptr<IRenderer> renderer = recorder_ ? std::shared_ptr<IRenderer>(recorder_) : renderer_;
+    stateManager_.setContext(GameContext(renderer, inputManager_, audioPlayer_));
 }
 
 void Game::loadInitialState() {
@@ -96,8 +134,15 @@ void Game::shutdown() {
         stateManager_.update(0); // Process pending pop
     }
 
-    // Reset services
-    ServiceLocator::reset();
+    // Release the world's references to the services
+    stateManager_.setContext(GameContext());
+
+    // Finish the frame in flight and release the GPU renderer on its thread
+    if (renderThread_) {
+        renderThread_->stop();
+        renderThread_.reset();
+    }
+    recorder_.reset();
 
     // Shutdown renderer
     if (renderer_) {
@@ -117,54 +162,135 @@ void Game::shutdown() {
 
 void Game::run() {
     constexpr float FIXED_DELTA = Constants::FIXED_DELTA_TIME;
-    constexpr float MAX_FRAME_TIME = 0.25f; // Prevent spiral of death
 
     while (running_) {
-        uint32_t currentTime = SDL_GetTicks();
-        float frameTime = (currentTime - previousTime_) / 1000.0f;
+        // Scaled and clamped (against a spiral of death) by the timer
+        const double currentTime = framePacer_.now();
+        simTimer_.advance(currentTime - previousTime_);
         previousTime_ = currentTime;
 
-        // Clamp frame time to prevent spiral of death
-        if (frameTime > MAX_FRAME_TIME) {
-            frameTime = MAX_FRAME_TIME;
-        }
-
-        accumulator_ += frameTime;
-
         // Process input
         processInput();
-
-        // Fixed time step updates
-        while (accumulator_ >= FIXED_DELTA) {
+        const uint32_t pollTime = inputManager_->getLastPollTime();
+
+        // Fixed time step updates. Simulated time trails the poll by whatever
+        // is still in the accumulator, so each tick consumes only the input
+        // events that arrived before the moment it represents. Under
+        // fast-forward many ticks run here and only the last one is drawn.
+        while (simTimer_.hasTick()) {
+            simTimer_.consumeTick();
+            processTickInput(pollTime - static_cast<uint32_t>(simTimer_.getRealSecondsBehind() * 1000.0));
             update(FIXED_DELTA);
-            accumulator_ -= FIXED_DELTA;
         }
 
-        // Render
-        render();
+        // Nothing is drawn while the window is hidden or unfocused
+        const bool windowActive = inputManager_->isWindowActive();
+        if (windowActive) {
+            render();
+        }
 
-        // Simple frame limiting (VSync should handle this, but just in case)
-        uint32_t frameMs = SDL_GetTicks() - currentTime;
-        if (frameMs < static_cast<uint32_t>(Constants::FRAME_TIME)) {
-            SDL_Delay(static_cast<uint32_t>(Constants::FRAME_TIME) - frameMs);
+        const float idleInterval = stateManager_.getIdleRedrawInterval();
+        if (idleInterval > 0.0f || !windowActive) {
+            waitForActivity(idleInterval);
+        } else {
+            // Only the limiter waits here; vsync already blocked in present()
+            framePacer_.waitForNextFrame();
         }
     }
+
+    reportLatency();
+}
+
+void Game::waitForActivity(float idleInterval) {
+    // Idle states only need the next redraw deadline; otherwise (a hidden
+    // window) keep simulating at the tick rate without drawing. Input that
+    // arrived after the last tick's cutoff is applied on the very next tick.
+    const float untilNextTick = static_cast<float>(simTimer_.getRealSecondsUntilNextTick());
+    float wait = idleInterval > 0.0f ? idleInterval : untilNextTick;
+    if (inputManager_->getPendingEventCount() > 0) {
+        wait = std::min(wait, untilNextTick);
+    }
+    inputManager_->waitForEvents(static_cast<uint32_t>(std::ceil(wait * 1000.0f)));
 }
 
 void Game::processInput() {
     inputManager_->processEvents();
+    framePacer_.markInputSampled();
+}
+
+void Game::processTickInput(uint32_t tickTime) {
+    inputManager_->beginTick(tickTime);
+    if (inputManager_->isKeyPressed(Scancode::F3)) {
+        showLatency_ = !showLatency_;
+    }
+    if (inputManager_->isKeyPressed(Scancode::F7)) {
+        setTimeScale(SimulationTimer::toggleSlowMotion(getTimeScale()));
+        std::cout << "Time scale: " << getTimeScale() << "x" << std::endl;
+    }
+    if (inputManager_->isKeyPressed(Scancode::F8)) {
+        setTimeScale(SimulationTimer::nextTurboScale(getTimeScale()));
+        std::cout << "Time scale: " << getTimeScale() << "x" << std::endl;
+    }
     stateManager_.handleInput(*inputManager_);
-    inputManager_->update();
 }
 
 void Game::update(float deltaTime) {
     stateManager_.update(deltaTime);
 }
 
+IRenderer& Game::frameRenderer() {
+    if (recorder_) {
+        return *recorder_;
+    }
+    return *renderer_;
+}
+
 void Game::render() {
-    renderer_->clear();
-    stateManager_.render(*renderer_);
-    renderer_->present();
+    IRenderer& renderer = frameRenderer();
+    renderer.clear();
+    // Draw between the last two ticks by the accumulator's leftover, so
+    // displays faster than the 60 Hz simulation get distinct, smooth frames.
+    stateManager_.render(renderer, simTimer_.getAlpha());
+    if (showLatency_) {
+        renderLatencyOverlay();
+    } else if (simTimer_.getTimeScale() != 1.0) {
+        char text[16];
+        std::snprintf(text, sizeof(text), "%gX", simTimer_.getTimeScale());
+        renderer.drawText(text, Vector2(Constants::WINDOW_WIDTH - 40.0f, 2.0f), Constants::COLOR_GREEN, 9);
+    }
+    // With the render thread this hands the frame over (blocking only while
+    // the previous one is still drawing), so latency is measured to hand-off.
+    renderer.present();
+    framePacer_.markPresented();
+}
+
+void Game::renderLatencyOverlay() {
+    const LatencyTracker& latency = framePacer_.getInputLatency();
+    const LatencyTracker& frames = framePacer_.getFrameTimes();
+
+    // SPEED is requested / achieved simulated seconds per real second
+    char text[128];
+    std::snprintf(text, sizeof(text), "%s LAT %.1f P99 %.1f FRAME %.1f MS SPEED %.2gX/%.2gX",
+                  FramePacer::modeName(framePacer_.getMode()),
+                  latency.getAverage() * 1000.0, latency.getPercentile(99.0) * 1000.0,
+                  frames.getAverage() * 1000.0,
+                  simTimer_.getTimeScale(), simTimer_.getEffectiveScale());
+    IRenderer& renderer = frameRenderer();
+    renderer.drawRect(0, 0, Constants::WINDOW_WIDTH, 14, 0, 0, 0, 180);
+    renderer.drawText(text, Vector2(4.0f, 2.0f), Constants::COLOR_GREEN, 9);
+}
+
+void Game::reportLatency() const {
+    const LatencyTracker& latency = framePacer_.getInputLatency();
+    if (latency.getSampleCount() == 0) {
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(2)
+              << "Input-to-present latency over the last " << latency.getSampleCount()
+              << " frames (" << FramePacer::modeName(framePacer_.getMode()) << "): avg "
+              << latency.getAverage() * 1000.0 << " ms, p50 " << latency.getPercentile(50.0) * 1000.0
+              << " ms, p99 " << latency.getPercentile(99.0) * 1000.0 << " ms, max "
+              << latency.getMax() * 1000.0 << " ms" << std::endl;
 }
 
 } // namespace tank
@@ -0,0 +1,174 @@
+#include "core/HeadlessRunner.hpp"
+#include "states/GameStateManager.hpp"
+#include "states/PlayingState.hpp"
+#include "utils/Constants.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace tank {
+namespace {
+
+bool parseInt(const char* text, long long minValue, long long maxValue, long long& value) {
+    if (!text || *text == '\0') {
+        return false;
+    }
+    char* end = nullptr;
+    const long long parsed = std::strtoll(text, &end, 10);
+    if (*end != '\0' || parsed < minValue || parsed > maxValue) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+} // namespace
+
+HeadlessRunner::HeadlessRunner(const HeadlessOptions& options)
+    : options_(options)
+{
+}
+
+HeadlessSummary HeadlessRunner::run() {
+    GameStateManager manager;
+    manager.beginRun();
+
+    auto state = std::make_unique<PlayingState>(manager, options_.level, options_.twoPlayer);
+    state->setRandomSeed(options_.seed);
+    state->setDefaultLevelFallback(false);
+    PlayingState* playing = state.get();
+    manager.pushState(std::move(state));
+    manager.update(0.0f);  // Apply the push and enter the level
+
+    HeadlessSummary summary;
+    if (playing->hasLevelLoadFailed()) {
+        summary.outcome = HeadlessOutcome::LevelLoadFailed;
+        return summary;
+    }
+    const auto start = std::chrono::steady_clock::now();
+
+    while (summary.ticks < options_.ticks) {
+        manager.update(Constants::FIXED_DELTA_TIME);
+        ++summary.ticks;
+
+        // A finished level queues a state change that would destroy the
+        // PlayingState on the next update, so stop while it is still alive.
+        if (playing->isLevelComplete()) {
+            summary.outcome = HeadlessOutcome::Victory;
+            break;
+        }
+        if (playing->isGameOver()) {
+            summary.outcome = HeadlessOutcome::Defeat;
+            break;
+        }
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    summary.wallSeconds = std::chrono::duration<double>(elapsed).count();
+    summary.simulatedSeconds = summary.ticks * static_cast<double>(Constants::FIXED_DELTA_TIME);
+    summary.ticksPerSecond = summary.wallSeconds > 0.0 ? summary.ticks / summary.wallSeconds : 0.0;
+    summary.player1Score = manager.getPlayerScore(1);
+    summary.player2Score = manager.getPlayerScore(2);
+    return summary;
+}
+
+int HeadlessRunner::runFromCommandLine(int argc, char* argv[]) {
+    HeadlessOptions options;
+    std::string error;
+    if (!parseArguments(argc, argv, options, error)) {
+        std::cerr << error << std::endl;
+        std::cerr << "Usage: " << (argc > 0 ? argv[0] : "TankSim")
+                  << " --headless [--level N] [--ticks T] [--seed S] [--players 1|2]" << std::endl;
+        return 2;
+    }
+
+    try {
+        HeadlessRunner runner(options);
+        const HeadlessSummary summary = runner.run();
+        if (summary.outcome == HeadlessOutcome::LevelLoadFailed) {
+            std::cerr << "Failed to load level " << options.level << std::endl;
+            return 1;
+        }
+        printSummary(summary, std::cout);
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Fatal error: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+bool HeadlessRunner::isRequested(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HeadlessRunner::parseArguments(int argc, char* argv[], HeadlessOptions& options, std::string& error) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--headless") {
+            continue;
+        }
+
+        const bool takesValue = arg == "--level" || arg == "--ticks" || arg == "--seed" || arg == "--players";
+        if (!takesValue) {
+            error = "Unknown argument: " + arg;
+            return false;
+        }
+        if (i + 1 >= argc) {
+            error = "Missing value for " + arg;
+            return false;
+        }
+
+        const char* text = argv[++i];
+        long long value = 0;
+        bool valid = false;
+        if (arg == "--level") {
+            valid = parseInt(text, 1, 999, value);
+            if (valid) options.level = static_cast<int>(value);
+        } else if (arg == "--ticks") {
+            valid = parseInt(text, 1, 1000000000LL, value);
+            if (valid) options.ticks = static_cast<int>(value);
+        } else if (arg == "--seed") {
+            valid = parseInt(text, 0, 0xFFFFFFFFLL, value);
+            if (valid) options.seed = static_cast<std::uint32_t>(value);
+        } else {
+            valid = parseInt(text, 1, 2, value);
+            if (valid) options.twoPlayer = value == 2;
+        }
+
+        if (!valid) {
+            error = "Invalid value for " + arg + ": " + text;
+            return false;
+        }
+    }
+    return true;
+}
+
+const char* HeadlessRunner::outcomeName(HeadlessOutcome outcome) {
+    switch (outcome) {
+        case HeadlessOutcome::Victory: return "victory";
+        case HeadlessOutcome::Defeat: return "defeat";
+        case HeadlessOutcome::LevelLoadFailed: return "level load failed";
+        case HeadlessOutcome::Running: break;
+    }
+    return "running";
+}
+
+void HeadlessRunner::printSummary(const HeadlessSummary& summary, std::ostream& out) {
+    out << std::fixed << std::setprecision(2)
+        << "ticks:      " << summary.ticks << " (" << summary.simulatedSeconds << "s simulated)\n"
+        << "wall time:  " << summary.wallSeconds << "s\n"
+        << "ticks/s:    " << summary.ticksPerSecond << "\n"
+        << "outcome:    " << outcomeName(summary.outcome) << "\n"
+        << "score:      P1 " << summary.player1Score << ", P2 " << summary.player2Score << std::endl;
+}
+
+} // namespace tank
@@ -0,0 +1,76 @@
+#include "core/ObjectPool.hpp"
+#include <cassert>
+#include <cstddef>
+#include <new>
+
+namespace tank {
+
+namespace {
+
+// Every slot is aligned for any ordinary type
+constexpr std::size_t SLOT_ALIGN = alignof(std::max_align_t);
+
+std::size_t roundUpToSlotAlign(std::size_t size) {
+    return (size + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+}
+
+} // namespace
+
+ObjectPool::ObjectPool(std::size_t slotSize, std::size_t capacity)
+    : slotSize_(roundUpToSlotAlign(slotSize))
+    , capacity_(capacity)
+    , storage_(std::make_unique<unsigned char[]>(getStride() * capacity_))  // Aligned for max_align_t
+    , owner_(std::this_thread::get_id())
+{
+    // Thread the free list through the slot headers, lowest address first
+    for (std::size_t i = capacity_; i-- > 0;) {
+        auto* slot = reinterpret_cast<FreeSlot*>(storage_.get() + i * getStride());
+        slot->next = freeList_;
+        freeList_ = slot;
+    }
+}
+
+void* ObjectPool::acquire(std::size_t size) {
+    assert(std::this_thread::get_id() == owner_ && "an ObjectPool stays on its world's thread");
+    if (size > slotSize_ || !freeList_) {
+        ++overflowCount_;
+        return allocateUnpooled(size);
+    }
+    FreeSlot* slot = freeList_;
+    freeList_ = slot->next;
+    ++inUse_;
+    Header* header = ::new (static_cast<void*>(slot)) Header{this};
+    return header + 1;
+}
+
+void* ObjectPool::allocateUnpooled(std::size_t size) {
+    Header* header = ::new (::operator new(sizeof(Header) + size)) Header{nullptr};
+    return header + 1;
+}
+
+void ObjectPool::release(void* pointer) {
+    if (!pointer) {
+        return;
+    }
+    Header* header = static_cast<Header*>(pointer) - 1;
+    if (header->pool) {
+        header->pool->releaseSlot(header);
+    } else {
+        ::operator delete(header);
+    }
+}
+
+void ObjectPool::releaseSlot(Header* header) {
+    assert(std::this_thread::get_id() == owner_ && "an ObjectPool stays on its world's thread");
+    auto* slot = reinterpret_cast<FreeSlot*>(header);
+    slot->next = freeList_;
+    freeList_ = slot;
+    --inUse_;
+}
+
+bool ObjectPool::owns(const void* pointer) const {
+    const auto* bytes = static_cast<const unsigned char*>(pointer);
+    return bytes >= storage_.get() && bytes < storage_.get() + getStride() * capacity_;
+}
+
+} // namespace tank
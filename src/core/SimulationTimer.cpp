@@ -0,0 +1,56 @@
+#include "core/SimulationTimer.hpp"
+#include <algorithm>
+
+namespace tank {
+
+void SimulationTimer::setTimeScale(double scale) {
+    timeScale_ = std::clamp(scale, MIN_TIME_SCALE, MAX_TIME_SCALE);
+    windowReal_ = 0.0;
+    windowSimulated_ = 0.0;
+    effectiveScale_ = timeScale_;
+}
+
+void SimulationTimer::advance(double realSeconds) {
+    if (realSeconds <= 0.0) {
+        return;
+    }
+
+    // Measure against unclamped real time: dropped time is exactly the
+    // shortfall we want to see.
+    windowReal_ += realSeconds;
+    if (windowReal_ >= MEASURE_WINDOW) {
+        effectiveScale_ = windowSimulated_ / windowReal_;
+        windowReal_ = 0.0;
+        windowSimulated_ = 0.0;
+    }
+
+    accumulator_ += std::min(realSeconds, MAX_FRAME_TIME) * timeScale_;
+}
+
+void SimulationTimer::consumeTick() {
+    accumulator_ -= step_;
+    windowSimulated_ += step_;
+}
+
+double SimulationTimer::getRealSecondsUntilNextTick() const {
+    return std::max(0.0, step_ - accumulator_) / timeScale_;
+}
+
+double SimulationTimer::nextTurboScale(double scale) {
+    if (scale < 2.0) {
+        return 2.0;
+    }
+    if (scale < 4.0) {
+        return 4.0;
+    }
+    if (scale < 16.0) {
+        return 16.0;
+    }
+    return 1.0;
+}
+
+double SimulationTimer::toggleSlowMotion(double scale) {
+    return scale < 1.0 ? 1.0 : 0.25;
+}
+
+} // namespace tank
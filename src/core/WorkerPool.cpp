@@ -0,0 +1,86 @@
+#include "core/WorkerPool.hpp"
+#include <algorithm>
+
+namespace tank {
+
+WorkerPool::WorkerPool(std::size_t workerCount) {
+    workers_.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back([this, lane = i + 1] { run(lane); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workReady_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::size_t WorkerPool::defaultWorkerCount(std::size_t maxWorkers) {
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? std::min<std::size_t>(hardware - 1, maxWorkers) : 0;
+}
+
+void WorkerPool::parallelFor(std::size_t count, const Task& task) {
+    if (workers_.empty() || count == 0) {
+        task(0, 0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        running_ = workers_.size();
+        ++generation_;
+    }
+    workReady_.notify_all();
+
+    runChunk(task, 0, count);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    workDone_.wait(lock, [this] { return running_ == 0; });
+    task_ = nullptr;
+}
+
+void WorkerPool::runChunk(const Task& task, std::size_t lane, std::size_t count) const {
+    const std::size_t lanes = getLaneCount();
+    const std::size_t begin = count * lane / lanes;
+    const std::size_t end = count * (lane + 1) / lanes;
+    if (begin < end) {
+        task(lane, begin, end);
+    }
+}
+
+void WorkerPool::run(std::size_t lane) {
+    std::uint64_t seen = 0;
+    for (;;) {
+        const Task* task;
+        std::size_t count;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            workReady_.wait(lock, [this, seen] { return stopping_ || generation_ != seen; });
+            if (stopping_) {
+                return;
+            }
+            seen = generation_;
+            task = task_;
+            count = count_;
+        }
+
+        runChunk(*task, lane, count);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --running_;
+        }
+        workDone_.notify_one();
+    }
+}
+
+} // namespace tank
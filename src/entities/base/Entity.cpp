@@ -1,15 +1,23 @@
 #include "entities/base/Entity.hpp"
+#include "core/EntityWorld.hpp"
 
 namespace tank {
 
 std::atomic<int> Entity::nextId_{0};
 
-Entity::Entity(const Vector2& position, float width, float height)
-    : id_(nextId_++)
+Entity::Entity(EntityWorld& world, const Vector2& position, float width, float height)
+    : world_(world)
+    , id_(nextId_++)
     , position_(position)
+    , tickStartPosition_(position)
     , width_(width)
     , height_(height)
 {
+    handle_ = world_.getHandles().create(this);
+}
+
+Entity::~Entity() {
+    world_.getHandles().destroy(handle_);
 }
 
 void Entity::update(float deltaTime) {
@@ -1,4 +1,5 @@
 #include "entities/effects/Effect.hpp"
+#include "core/EntityWorld.hpp"
 #include "rendering/IRenderer.hpp"
 #include "graphics/SpriteSheet.hpp"
 #include <string>
@@ -6,8 +7,8 @@
 namespace tank {
 
 // Base Effect implementation
-Effect::Effect(int x, int y, EffectType type)
-    : Entity(Vector2(static_cast<float>(x), static_cast<float>(y)),
+Effect::Effect(EntityWorld& world, int x, int y, EffectType type)
+    : Entity(world, Vector2(static_cast<float>(x), static_cast<float>(y)),
              static_cast<float>(Constants::ELEMENT_SIZE),
              static_cast<float>(Constants::ELEMENT_SIZE))
     , type_(type)
@@ -16,6 +17,19 @@ Effect::Effect(int x, int y, EffectType type)
     , targetPlayCount_(1)
 {
     renderLayer_ = RenderLayer::Effects;
+    kind_ = EntityKind::Effect;
+}
+
+void* Effect::operator new(std::size_t size) {
+    return ObjectPool::allocateUnpooled(size);
+}
+
+void Effect::operator delete(void* pointer) {
+    ObjectPool::release(pointer);
+}
+
+ObjectPool& Effect::getPool(EntityWorld& world) {
+    return world.getEffectPool();
 }
 
 void Effect::update(float deltaTime) {
@@ -35,8 +49,8 @@ void Effect::render(IRenderer& renderer) {
 }
 
 // SpawnEffect implementation
-SpawnEffect::SpawnEffect(int x, int y)
-    : Effect(x, y, EffectType::SpawnEffect)
+SpawnEffect::SpawnEffect(EntityWorld& world, int x, int y)
+    : Effect(world, x, y, EffectType::SpawnEffect)
     , currentFrame_(0)
     , frameTimer_(0.0f)
 {
@@ -71,8 +85,8 @@ void SpawnEffect::render(IRenderer& renderer) {
 }
 
 // BulletExplosion implementation
-BulletExplosion::BulletExplosion(int x, int y)
-    : Effect(x, y, EffectType::BulletExplosion)
+BulletExplosion::BulletExplosion(EntityWorld& world, int x, int y)
+    : Effect(world, x, y, EffectType::BulletExplosion)
     , currentFrame_(0)
     , frameTimer_(0.0f)
 {
@@ -107,8 +121,8 @@ void BulletExplosion::render(IRenderer& renderer) {
 }
 
 // TankExplosion implementation
-TankExplosion::TankExplosion(int x, int y)
-    : Effect(x, y, EffectType::TankExplosion)
+TankExplosion::TankExplosion(EntityWorld& world, int x, int y)
+    : Effect(world, x, y, EffectType::TankExplosion)
     , currentFrame_(0)
     , frameTimer_(0.0f)
 {
@@ -148,8 +162,8 @@ void TankExplosion::render(IRenderer& renderer) {
 }
 
 // InvincibilityEffect implementation
-InvincibilityEffect::InvincibilityEffect(int x, int y, float duration)
-    : Effect(x, y, EffectType::Invincibility)
+InvincibilityEffect::InvincibilityEffect(EntityWorld& world, int x, int y, float duration)
+    : Effect(world, x, y, EffectType::Invincibility)
     , duration_(duration)
     , elapsed_(0.0f)
     , expired_(false)
@@ -184,8 +198,10 @@ void InvincibilityEffect::update(float deltaTime) {
 void InvincibilityEffect::render(IRenderer& renderer) {
     if (expired_ || complete_) return;
 
-    int x = static_cast<int>(position_.x);
-    int y = static_cast<int>(position_.y);
+    // Follows its tank, so interpolate the same way the tank does
+    const Vector2 drawPos = getRenderPosition();
+    int x = static_cast<int>(drawPos.x);
+    int y = static_cast<int>(drawPos.y);
     int size = Constants::ELEMENT_SIZE;
 
     // Use shield sprite from sprite sheet
@@ -203,8 +219,8 @@ void InvincibilityEffect::setPosition(int x, int y) {
     position_.y = static_cast<float>(y);
 }
 
-ScorePopup::ScorePopup(int x, int y, int points, int multiplier)
-    : Effect(x, y, EffectType::ScorePopup)
+ScorePopup::ScorePopup(EntityWorld& world, int x, int y, int points, int multiplier)
+    : Effect(world, x, y, EffectType::ScorePopup)
     , points_(points)
     , multiplier_(multiplier)
 {
@@ -228,7 +244,7 @@ void ScorePopup::render(IRenderer& renderer) {
     if (multiplier_ > 1) {
         label += " x" + std::to_string(multiplier_);
     }
-    renderer.drawText(label, position_, Constants::Color(255, 220, 60), 12);
+    renderer.drawText(label, getRenderPosition(), Constants::Color(255, 220, 60), 12);
 }
 
 } // namespace tank
@@ -1,10 +1,23 @@
 #include "entities/powerups/PowerUp.hpp"
+#include "core/EntityWorld.hpp"
 #include "rendering/IRenderer.hpp"
 
 namespace tank {
 
-PowerUp::PowerUp(int x, int y, PowerUpType type)
-    : Entity(Vector2(static_cast<float>(x), static_cast<float>(y)),
+void* PowerUp::operator new(std::size_t size) {
+    return ObjectPool::allocateUnpooled(size);
+}
+
+void PowerUp::operator delete(void* pointer) {
+    ObjectPool::release(pointer);
+}
+
+ObjectPool& PowerUp::getPool(EntityWorld& world) {
+    return world.getPowerUpPool();
+}
+
+PowerUp::PowerUp(EntityWorld& world, int x, int y, PowerUpType type)
+    : Entity(world, Vector2(static_cast<float>(x), static_cast<float>(y)),
              static_cast<float>(Constants::ELEMENT_SIZE),
              static_cast<float>(Constants::ELEMENT_SIZE))
     , type_(type)
@@ -14,6 +27,7 @@ PowerUp::PowerUp(int x, int y, PowerUpType type)
     , expired_(false)
 {
     renderLayer_ = RenderLayer::PowerUps;
+    kind_ = EntityKind::PowerUp;
     initAnimation();
 }
 
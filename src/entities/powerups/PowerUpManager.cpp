@@ -1,4 +1,5 @@
 #include "entities/powerups/PowerUpManager.hpp"
+#include "core/EntityWorld.hpp"
 #include "entities/tanks/PlayerTank.hpp"
 #include <algorithm>
 
@@ -27,7 +28,7 @@ void PowerUpManager::render(IRenderer& renderer) {
 }
 
 void PowerUpManager::spawn(const Vector2& position, PowerUpType type) {
-    powerUps_.push_back(std::make_unique<PowerUp>(
+    powerUps_.push_back(world_.create<PowerUp>(
         static_cast<int>(position.x), static_cast<int>(position.y), type));
 }
 
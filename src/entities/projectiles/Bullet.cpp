@@ -1,46 +1,80 @@
 #include "entities/projectiles/Bullet.hpp"
+#include "core/EntityWorld.hpp"
 #include "entities/tanks/ITank.hpp"
 #include "graphics/SpriteSheet.hpp"
 
 namespace tank {
 
-Bullet::Bullet(const Vector2& position, Direction direction, ITank* owner, int level)
-    : Entity(position, static_cast<float>(Sprites::Bullet::SIZE), static_cast<float>(Sprites::Bullet::SIZE))
-    , owner_(owner)
-    , direction_(direction)
+Bullet::Bullet(EntityWorld& world, const Vector2& position, Direction direction, ITank* owner, int level)
+    : Entity(world, position, static_cast<float>(Sprites::Bullet::SIZE), static_cast<float>(Sprites::Bullet::SIZE))
+    , store_(&world.getBulletStore())
     , level_(level)
 {
+    init(position, direction, owner);
+}
+
+void Bullet::init(const Vector2& position, Direction direction, ITank* owner) {
     renderLayer_ = RenderLayer::Bullets;
+    kind_ = EntityKind::Bullet;
+    // The team outlives the owner, whose handle goes stale when the shooter
+    // is destroyed
+    owner_ = owner ? owner->getHandle() : EntityHandle();
+    team_ = owner ? owner->getTeam() : Team::Neutral;
+
+    slot_ = store_->allocate(this);
+    store_->positions_[slot_] = position;
+    store_->segmentStarts_[slot_] = position;
+    store_->directions_[slot_] = direction;
+    store_->alive_[slot_] = 1;
 
     // Base stats
-    speed_ = Constants::BULLET_DEFAULT_SPEED;
+    float speed = Constants::BULLET_DEFAULT_SPEED;
     attack_ = Constants::BULLET_DEFAULT_ATTACK;
 
     // Level upgrades
-    if (level >= 1) {
-        speed_ *= 2;
+    if (level_ >= 1) {
+        speed *= 2;
     }
-    if (level == 2) {
+    if (level_ == 2) {
         attack_ += 50;
-    } else if (level >= 3) {
+    } else if (level_ >= 3) {
         attack_ += 100;
     }
+    store_->speeds_[slot_] = speed;
+}
+
+void* Bullet::operator new(std::size_t size) {
+    return ObjectPool::allocateUnpooled(size);
+}
+
+void Bullet::operator delete(void* pointer) {
+    ObjectPool::release(pointer);
+}
+
+ObjectPool& Bullet::getPool(EntityWorld& world) {
+    return world.getBulletPool();
+}
+
+Bullet::~Bullet() {
+    store_->release(slot_);
+}
+
+void Bullet::setActive(bool active) {
+    active_ = active;
+    store_->alive_[slot_] = active_ && !hitTarget_;
 }
 
 void Bullet::move(Direction direction) {
-    direction_ = direction;
-    Vector2 delta = directionToVector(direction) * speed_;
-    position_ += delta;
+    setDirection(direction);
+    store_->positions_[slot_] += directionToVector(direction) * getSpeed();
 }
 
 void Bullet::onUpdate(float deltaTime) {
-    if (hitTarget_ || !active_) return;
-
-    // Move in current direction
-    move(direction_);
+    if (!isAlive()) return;
 
-    // Check bounds
-    if (isOutOfBounds()) {
+    // Move in current direction. A lone bullet has no contact pass to wait
+    // for, so leaving the map ends it at once.
+    if (!store_->step(slot_)) {
         die();
     }
 }
@@ -50,14 +84,16 @@ void Bullet::onRender(IRenderer& renderer) {
 
     // Classic bullet: a white rectangle elongated along the travel direction.
     // Drawn procedurally - the sprite sheet has no directional bullet sprites.
-    int x = static_cast<int>(position_.x);
-    int y = static_cast<int>(position_.y);
+    const Vector2 drawPos = getRenderPosition();
+    int x = static_cast<int>(drawPos.x);
+    int y = static_cast<int>(drawPos.y);
     int w = static_cast<int>(width_);
     int h = static_cast<int>(height_);
 
     int bodyW = w;
     int bodyH = h;
-    if (direction_ == Direction::Up || direction_ == Direction::Down) {
+    const Direction direction = getDirection();
+    if (direction == Direction::Up || direction == Direction::Down) {
         bodyW = w / 2;  // Vertical: narrow and tall
     } else {
         bodyH = h / 2;  // Horizontal: wide and short
@@ -67,27 +103,39 @@ void Bullet::onRender(IRenderer& renderer) {
                       bodyW, bodyH, 255, 255, 255, 255);
 }
 
+void Bullet::hit() {
+    hitTarget_ = true;
+    store_->alive_[slot_] = 0;
+}
+
 void Bullet::die() {
     hitTarget_ = true;
     active_ = false;
+    store_->alive_[slot_] = 0;
 
     // Notify owner that bullet is destroyed
-    if (owner_) {
-        owner_->onBulletDestroyed();
+    if (ITank* owner = getOwner()) {
+        owner->onBulletDestroyed();
     }
 
     // Explosion effect will be added later
 }
 
+ITank* Bullet::getOwner() const {
+    // Only tanks are ever stored as owners
+    return static_cast<ITank*>(world_.getHandles().get(owner_));
+}
+
 void Bullet::clearOwner() {
-    owner_ = nullptr;
+    owner_ = EntityHandle();
 }
 
 bool Bullet::isOutOfBounds() const {
-    return position_.x < 0 ||
-           position_.x >= Constants::GAME_WIDTH ||
-           position_.y < 0 ||
-           position_.y >= Constants::GAME_HEIGHT;
+    const Vector2 position = getPosition();
+    return position.x < 0 ||
+           position.x >= Constants::GAME_WIDTH ||
+           position.y < 0 ||
+           position.y >= Constants::GAME_HEIGHT;
 }
 
 } // namespace tank
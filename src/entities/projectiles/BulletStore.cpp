@@ -0,0 +1,65 @@
+#include "entities/projectiles/BulletStore.hpp"
+#include "entities/projectiles/Bullet.hpp"
+#include "graphics/SpriteSheet.hpp"
+#include <algorithm>
+
+namespace tank {
+
+std::uint32_t BulletStore::allocate(Bullet* object) {
+    if (!freeSlots_.empty()) {
+        const std::uint32_t slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        objects_[slot] = object;
+        return slot;
+    }
+    positions_.emplace_back();
+    segmentStarts_.emplace_back();
+    directions_.push_back(Direction::Up);
+    speeds_.push_back(0.0f);
+    alive_.push_back(0);
+    objects_.push_back(object);
+    return static_cast<std::uint32_t>(objects_.size() - 1);
+}
+
+void BulletStore::release(std::uint32_t slot) {
+    alive_[slot] = 0;
+    objects_[slot] = nullptr;
+    freeSlots_.push_back(slot);
+}
+
+bool BulletStore::isInsideMap(const Vector2& position) {
+    return position.x >= 0 && position.x < Constants::GAME_WIDTH &&
+           position.y >= 0 && position.y < Constants::GAME_HEIGHT;
+}
+
+bool BulletStore::step(std::uint32_t slot) {
+    Vector2& position = positions_[slot];
+    segmentStarts_[slot] = position;
+    position += directionToVector(directions_[slot]) * speeds_[slot];
+    // Stop where the box has just cleared the map, so the segment still
+    // covers everything inside it; the clamp keeps an outside point outside
+    const float size = static_cast<float>(Sprites::Bullet::SIZE);
+    position.x = std::clamp(position.x, -size, static_cast<float>(Constants::GAME_WIDTH));
+    position.y = std::clamp(position.y, -size, static_cast<float>(Constants::GAME_HEIGHT));
+    return isInsideMap(position);
+}
+
+void BulletStore::advance() {
+    const auto count = static_cast<std::uint32_t>(objects_.size());
+    for (std::uint32_t slot = 0; slot < count; ++slot) {
+        if (alive_[slot]) {
+            step(slot);
+        }
+    }
+}
+
+void BulletStore::retireOutOfBounds() {
+    const auto count = static_cast<std::uint32_t>(objects_.size());
+    for (std::uint32_t slot = 0; slot < count; ++slot) {
+        if (alive_[slot] && !isInsideMap(positions_[slot])) {
+            objects_[slot]->die();  // Rare: only here does the object get touched
+        }
+    }
+}
+
+} // namespace tank
@@ -2,18 +2,15 @@
 #include "graphics/SpriteSheet.hpp"
 #include <algorithm>
 #include <cmath>
-#include <random>
 
 namespace tank {
 
-// Random number generator
-static std::random_device rd;
-static std::mt19937 gen(rd());
-
-EnemyTank::EnemyTank(const Vector2& position, EnemyType type)
-    : Tank(position)
+EnemyTank::EnemyTank(EntityWorld& world, const Vector2& position, EnemyType type)
+    : Tank(world, position)
     , enemyType_(type)
 {
+    kind_ = EntityKind::EnemyTank;
+    team_ = Team::Enemy;
     direction_ = Direction::Down;
     initializeStats();
 }
@@ -64,9 +61,8 @@ void EnemyTank::setAIBehavior(std::unique_ptr<IAIBehavior> behavior) {
     aiBehavior_ = std::move(behavior);
 }
 
-void EnemyTank::randomFire() {
-    std::uniform_int_distribution<> dist(0, step_ > 0 ? step_ : 10);
-    fireChance_ = dist(gen);
+void EnemyTank::randomFire(RandomStream& random) {
+    fireChance_ = random.nextInt(0, step_ > 0 ? step_ : 10);
 }
 
 void EnemyTank::onUpdate(float deltaTime) {
@@ -104,8 +100,9 @@ void EnemyTank::onRender(IRenderer& renderer) {
 
     // Visual sprite (34x34) slightly larger than collision box (30x30)
     // Center the collision box in the visual
-    int destX = static_cast<int>(position_.x) - (Sprites::ELEMENT_SIZE - static_cast<int>(width_)) / 2;
-    int destY = static_cast<int>(position_.y) - (Sprites::ELEMENT_SIZE - static_cast<int>(height_)) / 2;
+    const Vector2 drawPos = getRenderPosition();
+    int destX = static_cast<int>(drawPos.x) - (Sprites::ELEMENT_SIZE - static_cast<int>(width_)) / 2;
+    int destY = static_cast<int>(drawPos.y) - (Sprites::ELEMENT_SIZE - static_cast<int>(height_)) / 2;
     int destSize = Sprites::ELEMENT_SIZE;  // 34
 
     renderer.drawSprite(srcX, srcY, Sprites::ELEMENT_SIZE, Sprites::ELEMENT_SIZE,
@@ -1,14 +1,16 @@
 #include "entities/tanks/PlayerTank.hpp"
-#include "core/ServiceLocator.hpp"
 #include "graphics/SpriteSheet.hpp"
 
 namespace tank {
 
-PlayerTank::PlayerTank(int playerId, const Vector2& spawnPosition)
-    : Tank(spawnPosition)
+PlayerTank::PlayerTank(EntityWorld& world, int playerId, const Vector2& spawnPosition)
+    : Tank(world, spawnPosition)
     , playerId_(playerId)
     , spawnPosition_(spawnPosition)
 {
+    kind_ = EntityKind::PlayerTank;
+    team_ = Team::Player;
+
     // Initial spawn with invincibility
     spawn(spawnPosition);
     makeInvincible(Constants::INVINCIBLE_DURATION / 1000.0f);
@@ -77,8 +79,9 @@ void PlayerTank::onRender(IRenderer& renderer) {
 
     // Visual sprite (34x34) slightly larger than collision box (30x30)
     // Center the collision box in the visual
-    int destX = static_cast<int>(position_.x) - (Sprites::ELEMENT_SIZE - static_cast<int>(width_)) / 2;
-    int destY = static_cast<int>(position_.y) - (Sprites::ELEMENT_SIZE - static_cast<int>(height_)) / 2;
+    const Vector2 drawPos = getRenderPosition();
+    int destX = static_cast<int>(drawPos.x) - (Sprites::ELEMENT_SIZE - static_cast<int>(width_)) / 2;
+    int destY = static_cast<int>(drawPos.y) - (Sprites::ELEMENT_SIZE - static_cast<int>(height_)) / 2;
     int destSize = Sprites::ELEMENT_SIZE;  // 34
 
     renderer.drawSprite(
@@ -99,8 +102,7 @@ void PlayerTank::onRender(IRenderer& renderer) {
 }
 
 void PlayerTank::onShoot() {
-    // Play shooting sound
-    // ServiceLocator::getAudio().playSound(SoundId::BulletShot);
+    // Shot sound is played by PlayingState through its GameContext
 
     // Bullet creation will be handled by the game state
 }
@@ -117,7 +119,6 @@ void PlayerTank::onSpawn() {
 
 void PlayerTank::onUpgrade() {
     // Play upgrade sound
-    // ServiceLocator::getAudio().playSound(SoundId::Star);
 }
 
 void PlayerTank::makeInvincible(float duration) {
@@ -1,4 +1,5 @@
 #include "entities/tanks/Tank.hpp"
+#include "core/EntityWorld.hpp"
 #include "graphics/SpriteSheet.hpp"
 #include <algorithm>
 #include <iostream>
@@ -7,11 +8,18 @@ namespace tank {
 
 std::atomic<int> Tank::nextId_{0};
 
-Tank::Tank(const Vector2& position)
-    : id_(nextId_++)
+Tank::Tank(EntityWorld& world, const Vector2& position)
+    : world_(world)
+    , id_(nextId_++)
     , position_(position)
     , previousPosition_(position)
+    , tickStartPosition_(position)
 {
+    handle_ = world_.getHandles().create(this);
+}
+
+Tank::~Tank() {
+    world_.getHandles().destroy(handle_);
 }
 
 Rectangle Tank::getBounds() const {
@@ -52,8 +60,9 @@ void Tank::render(IRenderer& renderer) {
             spawnTimer_ / (Constants::SPAWN_ANIMATION_DELAY / 1000.0f))) % 4;
         Rectangle srcRect = Sprites::Spawn::get(spawnFrame);
         // Match the tank sprite: 34x34 visual centered on the 24x24 collision box
-        int x = static_cast<int>(position_.x) - (Sprites::ELEMENT_SIZE - static_cast<int>(width_)) / 2;
-        int y = static_cast<int>(position_.y) - (Sprites::ELEMENT_SIZE - static_cast<int>(height_)) / 2;
+        const Vector2 drawPos = getRenderPosition();
+        int x = static_cast<int>(drawPos.x) - (Sprites::ELEMENT_SIZE - static_cast<int>(width_)) / 2;
+        int y = static_cast<int>(drawPos.y) - (Sprites::ELEMENT_SIZE - static_cast<int>(height_)) / 2;
         renderer.drawSprite(
             static_cast<int>(srcRect.x), static_cast<int>(srcRect.y),
             static_cast<int>(srcRect.width), static_cast<int>(srcRect.height),
@@ -180,6 +189,7 @@ void Tank::setLevel(int level) {
 void Tank::spawn(const Vector2& position) {
     position_ = position;
     previousPosition_ = position;
+    tickStartPosition_ = position;
     health_ = Constants::PLAYER_DEFAULT_HP;
     direction_ = Direction::Up;
     spawning_ = true;
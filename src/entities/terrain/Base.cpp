@@ -5,8 +5,8 @@
 
 namespace tank {
 
-Base::Base(int x, int y)
-    : Entity(Vector2(static_cast<float>(x), static_cast<float>(y)),
+Base::Base(EntityWorld& world, int x, int y)
+    : Entity(world, Vector2(static_cast<float>(x), static_cast<float>(y)),
              static_cast<float>(Constants::ELEMENT_SIZE),
              static_cast<float>(Constants::ELEMENT_SIZE))
     , health_(100)
@@ -16,6 +16,7 @@ Base::Base(int x, int y)
     , showDestroyedSprite_(false)
 {
     renderLayer_ = RenderLayer::Base;
+    kind_ = EntityKind::Base;
 }
 
 void Base::update(float deltaTime) {
@@ -0,0 +1,64 @@
+#include "entities/terrain/TerrainMap.hpp"
+#include <array>
+#include <cmath>
+
+namespace tank {
+
+namespace {
+
+constexpr int NEVER = TerrainMaterial::NEVER_BREAKS;
+
+// Indexed by TerrainType. Steel gives way only to fully upgraded bullets;
+// the base is its own entity and is listed for completeness.
+constexpr std::array<TerrainMaterial, 6> MATERIALS = {{
+    /* Empty */ {false, false, NEVER, 0, RenderLayer::Terrain},
+    /* Steel */ {true, true, 3, 100, RenderLayer::Terrain},
+    /* Brick */ {true, true, 0, 0, RenderLayer::Terrain},
+    /* Water */ {true, false, NEVER, 0, RenderLayer::Water},
+    /* Grass */ {false, false, NEVER, 0, RenderLayer::Grass},
+    /* Base  */ {true, true, NEVER, 0, RenderLayer::Base},
+}};
+
+} // namespace
+
+const TerrainMaterial& getTerrainMaterial(TerrainType type) {
+    return MATERIALS[static_cast<std::size_t>(type)];
+}
+
+TerrainMap::TerrainMap(int width, int height) {
+    reset(width, height);
+}
+
+void TerrainMap::reset(int width, int height) {
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    cells_.assign(static_cast<std::size_t>(width_ * height_), TerrainType::Empty);
+    count_ = 0;
+}
+
+void TerrainMap::clear() {
+    std::fill(cells_.begin(), cells_.end(), TerrainType::Empty);
+    count_ = 0;
+}
+
+void TerrainMap::set(int x, int y, TerrainType type) {
+    if (!contains(x, y)) {
+        return;
+    }
+    TerrainType& cell = cells_[index(x, y)];
+    count_ -= cell != TerrainType::Empty ? 1 : 0;
+    count_ += type != TerrainType::Empty ? 1 : 0;
+    cell = type;
+}
+
+TerrainMap::CellRange TerrainMap::cellsFor(const Rectangle& area) const {
+    const float size = static_cast<float>(Constants::CELL_SIZE);
+    CellRange range;
+    range.minX = std::max(0, static_cast<int>(std::floor(area.left() / size)));
+    range.minY = std::max(0, static_cast<int>(std::floor(area.top() / size)));
+    range.maxX = std::min(width_ - 1, static_cast<int>(std::ceil(area.right() / size)) - 1);
+    range.maxY = std::min(height_ - 1, static_cast<int>(std::ceil(area.bottom() / size)) - 1);
+    return range;
+}
+
+} // namespace tank
@@ -1,6 +1,7 @@
 #include "graphics/Animation.hpp"
 #include "rendering/IRenderer.hpp"
 #include <algorithm>
+#include <cassert>
 
 namespace tank {
 
@@ -34,31 +35,36 @@ Animation::Animation()
 }
 
 Animation::Animation(const std::vector<Frame>& frames, int frameDelay)
-    : frames_(frames)
-    , currentFrame_(0)
+    : currentFrame_(0)
     , frameDelay_(frameDelay)
     , elapsedTime_(0.0f)
     , timesPlayed_(0)
     , stopped_(true)
 {
+    for (const Frame& frame : frames) {
+        addFrame(frame);
+    }
 }
 
 void Animation::addFrame(const Frame& frame) {
-    frames_.push_back(frame);
+    assert(frameCount_ < MAX_FRAMES && "Animation::MAX_FRAMES too small for this animation");
+    if (frameCount_ < MAX_FRAMES) {
+        frames_[frameCount_++] = frame;
+    }
 }
 
 void Animation::start() {
-    if (!stopped_ || frames_.empty()) return;
+    if (!stopped_ || frameCount_ == 0) return;
     stopped_ = false;
 }
 
 void Animation::stop() {
-    if (frames_.empty()) return;
+    if (frameCount_ == 0) return;
     stopped_ = true;
 }
 
 void Animation::restart() {
-    if (frames_.empty()) return;
+    if (frameCount_ == 0) return;
     stopped_ = false;
     currentFrame_ = 0;
     elapsedTime_ = 0.0f;
@@ -72,7 +78,7 @@ void Animation::reset() {
 }
 
 void Animation::update(float deltaTime) {
-    if (stopped_ || frames_.empty()) return;
+    if (stopped_ || frameCount_ == 0) return;
 
     elapsedTime_ += deltaTime * 1000.0f;  // Convert to ms
 
@@ -80,7 +86,7 @@ void Animation::update(float deltaTime) {
         elapsedTime_ -= frameDelay_;
         ++currentFrame_;
 
-        if (currentFrame_ >= static_cast<int>(frames_.size())) {
+        if (currentFrame_ >= frameCount_) {
             currentFrame_ = 0;
             ++timesPlayed_;
         }
@@ -89,7 +95,7 @@ void Animation::update(float deltaTime) {
 
 const Frame& Animation::getCurrentFrame() const {
     static Frame emptyFrame(0, 0, 0, 0, 0);
-    if (frames_.empty()) return emptyFrame;
+    if (frameCount_ == 0) return emptyFrame;
     return frames_[currentFrame_];
 }
 
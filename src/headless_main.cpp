@@ -0,0 +1,46 @@
+/**
+ * @file headless_main.cpp
+ * @brief TankSim - headless match runner
+ *
+ * Links only the TankCore library: no SDL is loaded or initialized, so many
+ * simulation workers can be started cheaply (AI tuning, regression runs).
+ *
+ * Usage: TankSim [--level N] [--ticks T] [--seed S] [--players 1|2]
+ */
+
+#include "core/HeadlessRunner.hpp"
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+namespace {
+
+bool hasLevelAssets(const std::filesystem::path& root) {
+    std::error_code error;
+    return std::filesystem::is_directory(root / "assets" / "levels", error) && !error;
+}
+
+// Levels are loaded relative to the working directory; fall back to the
+// directory holding the executable, where the build copies the assets.
+void configureRuntimeWorkingDirectory(const char* executablePath) {
+    std::error_code error;
+    if (hasLevelAssets(std::filesystem::current_path(error)) || !executablePath) {
+        return;
+    }
+
+    const std::filesystem::path executableDirectory =
+        std::filesystem::absolute(executablePath, error).parent_path();
+    if (error || !hasLevelAssets(executableDirectory)) {
+        std::cerr << "Level assets were not found; using built-in defaults" << std::endl;
+        return;
+    }
+
+    std::filesystem::current_path(executableDirectory, error);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    configureRuntimeWorkingDirectory(argc > 0 ? argv[0] : nullptr);
+    return tank::HeadlessRunner::runFromCommandLine(argc, argv);
+}
@@ -2,8 +2,19 @@
 
 namespace tank {
 
+// Scancode/Keycode values are SDL's, so conversion is a cast.
+static_assert(SCANCODE_COUNT == SDL_NUM_SCANCODES, "Scancode range must match SDL");
+static_assert(static_cast<int>(Scancode::A) == SDL_SCANCODE_A, "Scancode values must match SDL");
+static_assert(static_cast<int>(Scancode::Num1) == SDL_SCANCODE_1, "Scancode values must match SDL");
+static_assert(static_cast<int>(Scancode::Return) == SDL_SCANCODE_RETURN, "Scancode values must match SDL");
+static_assert(static_cast<int>(Scancode::F1) == SDL_SCANCODE_F1, "Scancode values must match SDL");
+static_assert(static_cast<int>(Scancode::Up) == SDL_SCANCODE_UP, "Scancode values must match SDL");
+static_assert(static_cast<int>(Scancode::KeypadEnter) == SDL_SCANCODE_KP_ENTER, "Scancode values must match SDL");
+static_assert(static_cast<int>(Scancode::RightShift) == SDL_SCANCODE_RSHIFT, "Scancode values must match SDL");
+static_assert(static_cast<int32_t>(Keycode::W) == SDLK_w, "Keycode values must match SDL");
+static_assert(static_cast<int32_t>(Keycode::Escape) == SDLK_ESCAPE, "Keycode values must match SDL");
+
 InputManager::InputManager() {
-    eventKeys_.fill(false);
     currentMouseButtons_.fill(false);
     previousMouseButtons_.fill(false);
     initializeKeyMappings();
@@ -12,36 +23,31 @@ InputManager::InputManager() {
 void InputManager::initializeKeyMappings() {
     // Player 1: WASD + Space
     playerMappings_[0] = {
-        SDL_SCANCODE_W,      // up
-        SDL_SCANCODE_S,      // down
-        SDL_SCANCODE_A,      // left
-        SDL_SCANCODE_D,      // right
-        SDL_SCANCODE_SPACE   // fire
+        Scancode::W,      // up
+        Scancode::S,      // down
+        Scancode::A,      // left
+        Scancode::D,      // right
+        Scancode::Space   // fire
     };
 
     // Player 2: Arrow keys + Enter
     playerMappings_[1] = {
-        SDL_SCANCODE_UP,      // up
-        SDL_SCANCODE_DOWN,    // down
-        SDL_SCANCODE_LEFT,    // left
-        SDL_SCANCODE_RIGHT,   // right
-        SDL_SCANCODE_RETURN   // fire
+        Scancode::Up,      // up
+        Scancode::Down,    // down
+        Scancode::Left,    // left
+        Scancode::Right,   // right
+        Scancode::Return   // fire
     };
 }
 
 void InputManager::processEvents() {
-    // IMPORTANT: Call SDL_PumpEvents() to update SDL's internal keyboard state.
-    // This is required for SDL_GetKeyboardState() to work correctly.
     SDL_PumpEvents();
-
-    // Clear per-frame edge flags.
-    eventKeys_.fill(false);
-    eventKeycodes_.clear();
+    lastPollTime_ = SDL_GetTicks();
 
     SDL_Event event;
-    bool shouldClearKeyboardState = false;
     while (SDL_PollEvent(&event)) {
         InputEvent inputEvent;
+        inputEvent.timestamp = event.common.timestamp;
 
         switch (event.type) {
             case SDL_QUIT:
@@ -51,114 +57,196 @@ void InputManager::processEvents() {
 
             case SDL_KEYDOWN:
                 if (!event.key.repeat) {
-                    eventKeys_[event.key.keysym.scancode] = true;
-                    currentKeycodes_.insert(event.key.keysym.sym);
-                    eventKeycodes_.insert(event.key.keysym.sym);
                     inputEvent.type = InputEvent::Type::KeyDown;
-                    inputEvent.keycode = event.key.keysym.sym;
+                    inputEvent.keycode = static_cast<Keycode>(event.key.keysym.sym);
+                    inputEvent.scancode = static_cast<Scancode>(event.key.keysym.scancode);
                 }
                 break;
 
             case SDL_KEYUP:
-                currentKeycodes_.erase(event.key.keysym.sym);
                 inputEvent.type = InputEvent::Type::KeyUp;
-                inputEvent.keycode = event.key.keysym.sym;
+                inputEvent.keycode = static_cast<Keycode>(event.key.keysym.sym);
+                inputEvent.scancode = static_cast<Scancode>(event.key.keysym.scancode);
                 break;
 
             case SDL_WINDOWEVENT:
+                switch (event.window.event) {
+                    case SDL_WINDOWEVENT_SHOWN:
+                    case SDL_WINDOWEVENT_EXPOSED:
+                    case SDL_WINDOWEVENT_RESTORED:
+                        windowVisible_ = true;
+                        break;
+                    case SDL_WINDOWEVENT_HIDDEN:
+                    case SDL_WINDOWEVENT_MINIMIZED:
+                        windowVisible_ = false;
+                        break;
+                    case SDL_WINDOWEVENT_FOCUS_GAINED:
+                        windowFocused_ = true;
+                        break;
+                    case SDL_WINDOWEVENT_FOCUS_LOST:
+                        windowFocused_ = false;
+                        break;
+                }
+                // Key-up events are lost while unfocused, so drop everything
+                // (including not yet consumed events) right away.
                 if (event.window.event == SDL_WINDOWEVENT_FOCUS_LOST ||
                     event.window.event == SDL_WINDOWEVENT_HIDDEN) {
-                    shouldClearKeyboardState = true;
+                    clearState();
                 }
                 break;
 
             case SDL_MOUSEBUTTONDOWN:
-                inputEvent.type = InputEvent::Type::MouseButtonDown;
-                inputEvent.mouseX = event.button.x;
-                inputEvent.mouseY = event.button.y;
-                inputEvent.mouseButton = event.button.button;
-                mouseX_ = event.button.x;
-                mouseY_ = event.button.y;
-                if (event.button.button < MOUSE_BUTTON_COUNT) {
-                    currentMouseButtons_[event.button.button] = true;
-                }
-                break;
-
             case SDL_MOUSEBUTTONUP:
-                inputEvent.type = InputEvent::Type::MouseButtonUp;
+                inputEvent.type = event.type == SDL_MOUSEBUTTONDOWN
+                    ? InputEvent::Type::MouseButtonDown
+                    : InputEvent::Type::MouseButtonUp;
                 inputEvent.mouseX = event.button.x;
                 inputEvent.mouseY = event.button.y;
                 inputEvent.mouseButton = event.button.button;
-                mouseX_ = event.button.x;
-                mouseY_ = event.button.y;
-                if (event.button.button < MOUSE_BUTTON_COUNT) {
-                    currentMouseButtons_[event.button.button] = false;
-                }
                 break;
 
             case SDL_MOUSEMOTION:
                 inputEvent.type = InputEvent::Type::MouseMove;
                 inputEvent.mouseX = event.motion.x;
                 inputEvent.mouseY = event.motion.y;
-                mouseX_ = event.motion.x;
-                mouseY_ = event.motion.y;
                 break;
         }
 
-        if (inputEvent.type != InputEvent::Type::None && eventCallback_) {
+        if (inputEvent.type == InputEvent::Type::None) {
+            continue;
+        }
+        if (inputEvent.type != InputEvent::Type::Quit) {
+            queueEvent(inputEvent);
+        }
+        if (eventCallback_) {
             eventCallback_(inputEvent);
         }
     }
+}
+
+bool InputManager::waitForEvents(uint32_t timeoutMs) {
+    // A null event leaves the woken-on event in SDL's queue for processEvents.
+    return SDL_WaitEventTimeout(nullptr, static_cast<int>(timeoutMs)) != 0;
+}
 
-    if (shouldClearKeyboardState) {
-        eventKeys_.fill(false);
-        currentKeycodes_.clear();
-        previousKeycodes_.clear();
-        eventKeycodes_.clear();
-        currentMouseButtons_.fill(false);
-        previousMouseButtons_.fill(false);
-        return;
+void InputManager::queueEvent(const InputEvent& event) {
+    // Compact once everything queued so far has been consumed, so the vector
+    // keeps its capacity and steady-state polling never allocates.
+    if (pendingHead_ == pendingEvents_.size()) {
+        pendingEvents_.clear();
+        pendingHead_ = 0;
     }
+    pendingEvents_.push_back(event);
 }
 
-void InputManager::update() {
+void InputManager::beginTick(uint32_t tickTime) {
     previousMouseButtons_ = currentMouseButtons_;
     previousKeycodes_ = currentKeycodes_;
-    eventKeys_.fill(false);
-    eventKeycodes_.clear();
-}
+    pressedKeys_.reset();
+    pressedKeycodes_.reset();
 
-bool InputManager::isKeyDown(SDL_Keycode key) const {
-    return currentKeycodes_.find(key) != currentKeycodes_.end();
+    // Signed difference so the comparison survives SDL_GetTicks() wrap-around.
+    while (pendingHead_ < pendingEvents_.size() &&
+           static_cast<int32_t>(pendingEvents_[pendingHead_].timestamp - tickTime) <= 0) {
+        applyEvent(pendingEvents_[pendingHead_]);
+        ++pendingHead_;
+    }
 }
 
-bool InputManager::isKeyPressed(SDL_Keycode key) const {
-    return eventKeycodes_.find(key) != eventKeycodes_.end();
+void InputManager::applyEvent(const InputEvent& event) {
+    const int scancode = static_cast<int>(event.scancode);
+    const bool hasScancode = scancode > 0 && scancode < SCANCODE_COUNT;
+    const int slot = keycodeSlot(event.keycode);
+
+    switch (event.type) {
+        case InputEvent::Type::KeyDown:
+            if (hasScancode) {
+                currentKeys_.set(scancode);
+                pressedKeys_.set(scancode);
+            }
+            if (slot >= 0) {
+                currentKeycodes_.set(slot);
+                pressedKeycodes_.set(slot);
+            }
+            break;
+
+        case InputEvent::Type::KeyUp:
+            if (hasScancode) {
+                currentKeys_.reset(scancode);
+            }
+            if (slot >= 0) {
+                currentKeycodes_.reset(slot);
+            }
+            break;
+
+        case InputEvent::Type::MouseButtonDown:
+        case InputEvent::Type::MouseButtonUp:
+            mouseX_ = event.mouseX;
+            mouseY_ = event.mouseY;
+            if (event.mouseButton >= 0 && event.mouseButton < MOUSE_BUTTON_COUNT) {
+                currentMouseButtons_[event.mouseButton] = event.type == InputEvent::Type::MouseButtonDown;
+            }
+            break;
+
+        case InputEvent::Type::MouseMove:
+            mouseX_ = event.mouseX;
+            mouseY_ = event.mouseY;
+            break;
+
+        default:
+            break;
+    }
 }
 
-bool InputManager::isKeyReleased(SDL_Keycode key) const {
-    const bool isDownNow = currentKeycodes_.find(key) != currentKeycodes_.end();
-    const bool wasDown = previousKeycodes_.find(key) != previousKeycodes_.end();
-    return !isDownNow && wasDown;
+void InputManager::clearState() {
+    currentKeys_.reset();
+    pressedKeys_.reset();
+    currentKeycodes_.reset();
+    previousKeycodes_.reset();
+    pressedKeycodes_.reset();
+    currentMouseButtons_.fill(false);
+    previousMouseButtons_.fill(false);
+    pendingEvents_.clear();
+    pendingHead_ = 0;
 }
 
-bool InputManager::isKeyDown(SDL_Scancode scancode) const {
-    if (scancode < SDL_NUM_SCANCODES) {
-        // Use SDL's real-time keyboard state
-        const Uint8* state = SDL_GetKeyboardState(NULL);
-        return state && state[scancode] != 0;
+int InputManager::keycodeSlot(Keycode key) {
+    const int32_t value = static_cast<int32_t>(key);
+    if (value > 0 && value < PRINTABLE_KEYCODES) {
+        return value;
     }
-    return false;
+    const int32_t scancode = value & ~SDLK_SCANCODE_MASK;
+    if ((value & SDLK_SCANCODE_MASK) != 0 && scancode > 0 && scancode < SCANCODE_COUNT) {
+        return PRINTABLE_KEYCODES + scancode;
+    }
+    return -1;
 }
 
-bool InputManager::isKeyPressed(SDL_Scancode scancode) const {
-    if (scancode < SDL_NUM_SCANCODES) {
-        // Key was pressed this frame (edge trigger). The edge set alone is
-        // authoritative here: also requiring the real-time state would drop
-        // quick taps that press and release within a single frame.
-        return eventKeys_[scancode];
-    }
-    return false;
+bool InputManager::isKeyDown(Keycode key) const {
+    const int slot = keycodeSlot(key);
+    return slot >= 0 && currentKeycodes_.test(slot);
+}
+
+bool InputManager::isKeyPressed(Keycode key) const {
+    const int slot = keycodeSlot(key);
+    return slot >= 0 && pressedKeycodes_.test(slot);
+}
+
+bool InputManager::isKeyReleased(Keycode key) const {
+    const int slot = keycodeSlot(key);
+    return slot >= 0 && !currentKeycodes_.test(slot) && previousKeycodes_.test(slot);
+}
+
+bool InputManager::isKeyDown(Scancode scancode) const {
+    const int index = static_cast<int>(scancode);
+    return index < SCANCODE_COUNT && currentKeys_.test(index);
+}
+
+bool InputManager::isKeyPressed(Scancode scancode) const {
+    const int index = static_cast<int>(scancode);
+    // The edge set alone is authoritative: also requiring the held state
+    // would drop quick taps that press and release within a single tick.
+    return index < SCANCODE_COUNT && pressedKeys_.test(index);
 }
 
 bool InputManager::isMouseButtonDown(uint8_t button) const {
@@ -186,11 +274,11 @@ PlayerInput InputManager::getPlayer1Input() const {
     PlayerInput input;
 
     const KeyMapping& mapping = playerMappings_[0];
-    input.up = isKeyDown(mapping.up) || isKeyDown(SDLK_w);
-    input.down = isKeyDown(mapping.down) || isKeyDown(SDLK_s);
-    input.left = isKeyDown(mapping.left) || isKeyDown(SDLK_a);
-    input.right = isKeyDown(mapping.right) || isKeyDown(SDLK_d);
-    input.fire = isKeyDown(mapping.fire) || isKeyDown(SDLK_SPACE);
+    input.up = isKeyDown(mapping.up) || isKeyDown(Keycode::W);
+    input.down = isKeyDown(mapping.down) || isKeyDown(Keycode::S);
+    input.left = isKeyDown(mapping.left) || isKeyDown(Keycode::A);
+    input.right = isKeyDown(mapping.right) || isKeyDown(Keycode::D);
+    input.fire = isKeyDown(mapping.fire) || isKeyDown(Keycode::Space);
 
     return input;
 }
@@ -202,7 +290,7 @@ PlayerInput InputManager::getPlayer2Input() const {
     input.down = isKeyDown(mapping.down);
     input.left = isKeyDown(mapping.left);
     input.right = isKeyDown(mapping.right);
-    input.fire = isKeyDown(mapping.fire) || isKeyDown(SDL_SCANCODE_KP_ENTER) || isKeyDown(SDL_SCANCODE_RCTRL);
+    input.fire = isKeyDown(mapping.fire) || isKeyDown(Scancode::KeypadEnter) || isKeyDown(Scancode::RightCtrl);
     return input;
 }
 
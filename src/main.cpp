@@ -10,10 +10,13 @@
  */
 
 #include "core/Game.hpp"
+#include "core/HeadlessRunner.hpp"
 #include <SDL.h>  // Required for SDL_main handling on Windows
+#include <cstdlib>
 #include <exception>
 #include <filesystem>
 #include <iostream>
+#include <string>
 #include <system_error>
 
 namespace {
@@ -59,14 +62,61 @@ void configureRuntimeWorkingDirectory() {
     }
 }
 
+// Windowed-mode options: --pacing vsync|limit|uncapped, --fps N,
+// --render-thread on|off, --time-scale X
+bool configureGame(int argc, char* argv[], tank::Game& game) {
+    tank::PacingMode mode = tank::PacingMode::VSync;
+    double fps = tank::Constants::TARGET_FPS;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--pacing" && i + 1 < argc) {
+            if (!tank::FramePacer::parseMode(argv[++i], mode)) {
+                std::cerr << "Unknown pacing mode: " << argv[i] << " (vsync, limit, uncapped)" << std::endl;
+                return false;
+            }
+        } else if (arg == "--fps" && i + 1 < argc) {
+            fps = std::atof(argv[++i]);
+            if (fps < 10.0 || fps > 1000.0) {
+                std::cerr << "--fps must be between 10 and 1000" << std::endl;
+                return false;
+            }
+        } else if (arg == "--time-scale" && i + 1 < argc) {
+            const double scale = std::atof(argv[++i]);
+            if (scale < tank::SimulationTimer::MIN_TIME_SCALE || scale > tank::SimulationTimer::MAX_TIME_SCALE) {
+                std::cerr << "--time-scale must be between 0.125 and 16" << std::endl;
+                return false;
+            }
+            game.setTimeScale(scale);
+        } else if (arg == "--render-thread" && i + 1 < argc) {
+            const std::string value = argv[++i];
+            if (value != "on" && value != "off") {
+                std::cerr << "--render-thread must be on or off" << std::endl;
+                return false;
+            }
+            game.setRenderThreadEnabled(value == "on");
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            std::cerr << "Usage: TankGame [--pacing vsync|limit|uncapped] [--fps N] [--render-thread on|off] [--time-scale X]"
+                      << std::endl;
+            return false;
+        }
+    }
+
+    game.setPacing(mode, fps);
+    return true;
+}
+
 } // namespace
 
 int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
-
     configureRuntimeWorkingDirectory();
 
+    // Headless runs never initialize SDL video, input or audio.
+    if (tank::HeadlessRunner::isRequested(argc, argv)) {
+        return tank::HeadlessRunner::runFromCommandLine(argc, argv);
+    }
+
     std::cout << "==================================" << std::endl;
     std::cout << "  Tank Battle - C++ Edition" << std::endl;
     std::cout << "  Built with SDL2 + SOLID" << std::endl;
@@ -74,6 +124,9 @@ int main(int argc, char* argv[]) {
 
     try {
         tank::Game game;
+        if (!configureGame(argc, argv, game)) {
+            return 2;
+        }
 
         if (!game.initialize()) {
             std::cerr << "Failed to initialize game" << std::endl;
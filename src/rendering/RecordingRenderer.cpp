@@ -0,0 +1,42 @@
+#include "rendering/RecordingRenderer.hpp"
+#include <utility>
+
+namespace tank {
+
+RecordingRenderer::RecordingRenderer(IRenderer& backend, SubmitFunction submit)
+    : backend_(backend)
+    , submit_(std::move(submit))
+{
+}
+
+bool RecordingRenderer::initialize(const std::string&, int, int) {
+    // The backend owns the window; it is set up before recording starts.
+    return true;
+}
+
+void RecordingRenderer::shutdown() {
+    frame_.clear();
+    textureCache_.clear();
+    nextTextureId_ = 1;
+}
+
+void RecordingRenderer::present() {
+    if (submit_) {
+        submit_(frame_);
+    }
+    frame_.clear();
+}
+
+TextureHandle RecordingRenderer::loadTexture(const std::string& path) {
+    auto it = textureCache_.find(path);
+    if (it != textureCache_.end()) {
+        return it->second;
+    }
+
+    const TextureHandle handle{nextTextureId_++};
+    textureCache_[path] = handle;
+    frame_.loadTexture(path, handle);
+    return handle;
+}
+
+} // namespace tank
@@ -0,0 +1,153 @@
+#include "rendering/RenderCommandList.hpp"
+
+namespace tank {
+
+void RenderCommandList::clear() {
+    commands_.clear();
+    strings_.clear();
+}
+
+RenderCommand& RenderCommandList::append(RenderCommand::Type type) {
+    commands_.emplace_back();
+    RenderCommand& command = commands_.back();
+    command.type = type;
+    return command;
+}
+
+void RenderCommandList::storeText(RenderCommand& command, const std::string& text) {
+    command.textOffset = static_cast<uint32_t>(strings_.size());
+    command.textLength = static_cast<uint32_t>(text.size());
+    strings_ += text;
+}
+
+std::string RenderCommandList::getText(const RenderCommand& command) const {
+    return strings_.substr(command.textOffset, command.textLength);
+}
+
+void RenderCommandList::clearScreen() {
+    append(RenderCommand::Type::Clear);
+}
+
+void RenderCommandList::clearScreen(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    append(RenderCommand::Type::ClearColor).color = Constants::Color(r, g, b, a);
+}
+
+void RenderCommandList::setDrawColor(const Constants::Color& color) {
+    append(RenderCommand::Type::SetDrawColor).color = color;
+}
+
+void RenderCommandList::fillRect(int x, int y, int w, int h, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    RenderCommand& command = append(RenderCommand::Type::FillRect);
+    command.values[0] = x;
+    command.values[1] = y;
+    command.values[2] = w;
+    command.values[3] = h;
+    command.color = Constants::Color(r, g, b, a);
+}
+
+void RenderCommandList::drawRectangle(const tank::Rectangle& rect, const Constants::Color& color, bool filled) {
+    RenderCommand& command = append(RenderCommand::Type::Rectangle);
+    command.dest = rect;
+    command.color = color;
+    command.filled = filled;
+}
+
+void RenderCommandList::drawSprite(int srcX, int srcY, int srcW, int srcH,
+                                   int destX, int destY, int destW, int destH) {
+    RenderCommand& command = append(RenderCommand::Type::Sprite);
+    command.values[0] = srcX;
+    command.values[1] = srcY;
+    command.values[2] = srcW;
+    command.values[3] = srcH;
+    command.values[4] = destX;
+    command.values[5] = destY;
+    command.values[6] = destW;
+    command.values[7] = destH;
+}
+
+void RenderCommandList::drawTexture(TextureHandle texture, const tank::Rectangle& dest) {
+    RenderCommand& command = append(RenderCommand::Type::Texture);
+    command.texture = texture;
+    command.dest = dest;
+}
+
+void RenderCommandList::drawTexture(TextureHandle texture, const tank::Rectangle& src,
+                                    const tank::Rectangle& dest) {
+    RenderCommand& command = append(RenderCommand::Type::TextureRegion);
+    command.texture = texture;
+    command.src = src;
+    command.dest = dest;
+}
+
+void RenderCommandList::drawText(const std::string& text, const Vector2& pos,
+                                 const Constants::Color& color, int fontSize) {
+    RenderCommand& command = append(RenderCommand::Type::Text);
+    command.position = pos;
+    command.color = color;
+    command.fontSize = fontSize;
+    storeText(command, text);
+}
+
+void RenderCommandList::loadTexture(const std::string& path, TextureHandle handle) {
+    RenderCommand& command = append(RenderCommand::Type::LoadTexture);
+    command.texture = handle;
+    storeText(command, path);
+}
+
+void RenderCommandList::setSpriteSheet(const std::string& path) {
+    storeText(append(RenderCommand::Type::SetSpriteSheet), path);
+}
+
+void RenderCommandList::replay(IRenderer& target, TextureTable& textures) const {
+    auto backendTexture = [&textures](TextureHandle handle) {
+        return handle && handle.id <= textures.size() ? textures[handle.id - 1] : TextureHandle{};
+    };
+
+    for (const RenderCommand& command : commands_) {
+        const int32_t* v = command.values;
+        const Constants::Color& c = command.color;
+
+        switch (command.type) {
+            case RenderCommand::Type::Clear:
+                target.clear();
+                break;
+            case RenderCommand::Type::ClearColor:
+                target.clear(c.r, c.g, c.b, c.a);
+                break;
+            case RenderCommand::Type::SetDrawColor:
+                target.setDrawColor(c);
+                break;
+            case RenderCommand::Type::FillRect:
+                target.drawRect(v[0], v[1], v[2], v[3], c.r, c.g, c.b, c.a);
+                break;
+            case RenderCommand::Type::Rectangle:
+                target.drawRectangle(command.dest, c, command.filled);
+                break;
+            case RenderCommand::Type::Sprite:
+                target.drawSprite(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]);
+                break;
+            case RenderCommand::Type::Texture:
+                target.drawTexture(backendTexture(command.texture), command.dest);
+                break;
+            case RenderCommand::Type::TextureRegion:
+                target.drawTexture(backendTexture(command.texture), command.src, command.dest);
+                break;
+            case RenderCommand::Type::Text:
+                target.drawText(getText(command), command.position, c, command.fontSize);
+                break;
+            case RenderCommand::Type::LoadTexture:
+                if (command.texture) {
+                    if (textures.size() < command.texture.id) {
+                        textures.resize(command.texture.id);
+                    }
+                    textures[command.texture.id - 1] = target.loadTexture(getText(command));
+                }
+                break;
+            case RenderCommand::Type::SetSpriteSheet:
+                target.setSpriteSheet(getText(command));
+                break;
+        }
+    }
+}
+
+} // namespace tank
@@ -0,0 +1,101 @@
+#include "rendering/RenderThread.hpp"
+#include <future>
+#include <utility>
+
+namespace tank {
+
+RenderThread::RenderThread(IRenderer& backend)
+    : backend_(backend)
+{
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+bool RenderThread::start(std::function<bool()> setUp, std::function<void()> tearDown) {
+    if (thread_.joinable()) {
+        return true;
+    }
+
+    stopping_ = false;
+    std::promise<bool> started;
+    std::future<bool> result = started.get_future();
+    thread_ = std::thread([this, &started, setUp = std::move(setUp), tearDown = std::move(tearDown)]() mutable {
+        const bool ok = !setUp || setUp();
+        started.set_value(ok);
+        if (ok) {
+            run(std::move(tearDown));
+        }
+    });
+
+    if (!result.get()) {
+        thread_.join();
+        return false;
+    }
+    return true;
+}
+
+void RenderThread::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    frameQueued_.notify_one();
+    thread_.join();
+}
+
+void RenderThread::submit(RenderCommandList& frame) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frameDone_.wait(lock, [this] { return !frameReady_ && !drawing_; });
+    std::swap(pending_, frame);
+    frame.clear();
+    frameReady_ = true;
+    lock.unlock();
+    frameQueued_.notify_one();
+}
+
+void RenderThread::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frameDone_.wait(lock, [this] { return !thread_.joinable() || (!frameReady_ && !drawing_); });
+}
+
+uint64_t RenderThread::getFramesPresented() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return framesPresented_;
+}
+
+void RenderThread::run(std::function<void()> tearDown) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frameQueued_.wait(lock, [this] { return frameReady_ || stopping_; });
+            if (!frameReady_) {
+                break;
+            }
+            frameReady_ = false;
+            drawing_ = true;
+        }
+
+        // The main thread does not touch pending_ until drawing_ clears.
+        pending_.replay(backend_, textures_);
+        backend_.present();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            drawing_ = false;
+            ++framesPresented_;
+        }
+        frameDone_.notify_all();
+    }
+
+    if (tearDown) {
+        tearDown();
+    }
+    textures_.clear();
+}
+
+} // namespace tank
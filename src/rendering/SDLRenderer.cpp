@@ -8,6 +8,10 @@ SDLRenderer::~SDLRenderer() {
 }
 
 bool SDLRenderer::initialize(const std::string& title, int width, int height) {
+    return createWindow(title, width, height) && createRenderer();
+}
+
+bool SDLRenderer::createWindow(const std::string& title, int width, int height) {
     width_ = width;
     height_ = height;
 
@@ -45,12 +49,23 @@ bool SDLRenderer::initialize(const std::string& title, int width, int height) {
         return false;
     }
 
+    // Set default font path
+    defaultFontPath_ = "assets/joystix.ttf";
+
+    // IMPORTANT: Disable text input to prevent IME from intercepting keyboard events
+    // This is required for game keyboard input to work correctly
+    SDL_StopTextInput();
+
+    return true;
+}
+
+bool SDLRenderer::createRenderer() {
     // Create renderer
-    renderer_ = SDL_CreateRenderer(
-        window_,
-        -1,
-        SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
-    );
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+    if (vsyncRequested_) {
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer_ = SDL_CreateRenderer(window_, -1, rendererFlags);
 
     if (!renderer_) {
         std::cerr << "Renderer creation failed: " << SDL_GetError() << std::endl;
@@ -62,26 +77,32 @@ bool SDLRenderer::initialize(const std::string& title, int width, int height) {
         std::cerr << "Failed to enable alpha blending: " << SDL_GetError() << std::endl;
     }
 
-    // Set default font path
-    defaultFontPath_ = "assets/joystix.ttf";
-
-    // IMPORTANT: Disable text input to prevent IME from intercepting keyboard events
-    // This is required for game keyboard input to work correctly
-    SDL_StopTextInput();
-
     std::cout << "SDL Renderer initialized successfully" << std::endl;
     return true;
 }
 
 void SDLRenderer::shutdown() {
+    destroyRenderer();
     clearFontCache();
 
+    if (window_) {
+        SDL_DestroyWindow(window_);
+        window_ = nullptr;
+    }
+
+    TTF_Quit();
+    IMG_Quit();
+    SDL_Quit();
+}
+
+void SDLRenderer::destroyRenderer() {
     // Destroy all cached textures (sprite sheet included - it is cache-owned)
-    for (auto& [path, texture] : textureCache_) {
+    for (SDL_Texture* texture : textures_) {
         if (texture) {
             SDL_DestroyTexture(texture);
         }
     }
+    textures_.clear();
     textureCache_.clear();
     spriteSheet_ = nullptr;
 
@@ -89,15 +110,14 @@ void SDLRenderer::shutdown() {
         SDL_DestroyRenderer(renderer_);
         renderer_ = nullptr;
     }
+}
 
-    if (window_) {
-        SDL_DestroyWindow(window_);
-        window_ = nullptr;
+bool SDLRenderer::isVSyncActive() const {
+    SDL_RendererInfo info;
+    if (!renderer_ || SDL_GetRendererInfo(renderer_, &info) != 0) {
+        return false;
     }
-
-    TTF_Quit();
-    IMG_Quit();
-    SDL_Quit();
+    return (info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
 }
 
 void SDLRenderer::clear() {
@@ -130,7 +150,7 @@ void SDLRenderer::drawRectangle(const Rectangle& rect, const Constants::Color& c
     }
 }
 
-SDL_Texture* SDLRenderer::loadTexture(const std::string& path) {
+TextureHandle SDLRenderer::loadTexture(const std::string& path) {
     auto it = textureCache_.find(path);
     if (it != textureCache_.end()) {
         return it->second;
@@ -139,7 +159,7 @@ SDL_Texture* SDLRenderer::loadTexture(const std::string& path) {
     SDL_Surface* surface = IMG_Load(path.c_str());
     if (!surface) {
         std::cerr << "Failed to load image: " << path << " - " << IMG_GetError() << std::endl;
-        return nullptr;
+        return TextureHandle{};
     }
 
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer_, surface);
@@ -147,14 +167,24 @@ SDL_Texture* SDLRenderer::loadTexture(const std::string& path) {
 
     if (!texture) {
         std::cerr << "Failed to create texture: " << SDL_GetError() << std::endl;
-        return nullptr;
+        return TextureHandle{};
     }
 
-    textureCache_[path] = texture;
-    return texture;
+    textures_.push_back(texture);
+    const TextureHandle handle{static_cast<uint32_t>(textures_.size())};
+    textureCache_[path] = handle;
+    return handle;
+}
+
+SDL_Texture* SDLRenderer::resolveTexture(TextureHandle texture) const {
+    if (!texture || texture.id > textures_.size()) {
+        return nullptr;
+    }
+    return textures_[texture.id - 1];
 }
 
-void SDLRenderer::drawTexture(SDL_Texture* texture, const Rectangle& dest) {
+void SDLRenderer::drawTexture(TextureHandle handle, const Rectangle& dest) {
+    SDL_Texture* texture = resolveTexture(handle);
     if (!texture) return;
 
     SDL_Rect destRect = {
@@ -167,7 +197,8 @@ void SDLRenderer::drawTexture(SDL_Texture* texture, const Rectangle& dest) {
     SDL_RenderCopy(renderer_, texture, nullptr, &destRect);
 }
 
-void SDLRenderer::drawTexture(SDL_Texture* texture, const Rectangle& src, const Rectangle& dest) {
+void SDLRenderer::drawTexture(TextureHandle handle, const Rectangle& src, const Rectangle& dest) {
+    SDL_Texture* texture = resolveTexture(handle);
     if (!texture) return;
 
     SDL_Rect srcRect = {
@@ -189,11 +220,15 @@ void SDLRenderer::drawTexture(SDL_Texture* texture, const Rectangle& src, const
 
 void SDLRenderer::drawText(const std::string& text, const Vector2& pos,
                            const Constants::Color& color, int fontSize) {
-    TTF_Font* font = getFont(fontSize);
-    if (!font) return;
-
-    SDL_Color sdlColor = {color.r, color.g, color.b, color.a};
-    SDL_Surface* surface = TTF_RenderText_Solid(font, text.c_str(), sdlColor);
+    SDL_Surface* surface = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(fontMutex_);
+        TTF_Font* font = getFont(fontSize);
+        if (!font) return;
+
+        SDL_Color sdlColor = {color.r, color.g, color.b, color.a};
+        surface = TTF_RenderText_Solid(font, text.c_str(), sdlColor);
+    }
     if (!surface) return;
 
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer_, surface);
@@ -212,6 +247,7 @@ void SDLRenderer::drawText(const std::string& text, const Vector2& pos,
 }
 
 Vector2 SDLRenderer::measureText(const std::string& text, int fontSize) {
+    std::lock_guard<std::mutex> lock(fontMutex_);
     TTF_Font* font = getFont(fontSize);
     if (!font) return Vector2(0.0f, 0.0f);
 
@@ -236,6 +272,7 @@ TTF_Font* SDLRenderer::getFont(int size) {
 }
 
 void SDLRenderer::clearFontCache() {
+    std::lock_guard<std::mutex> lock(fontMutex_);
     for (auto& [size, font] : fontCache_) {
         if (font) {
             TTF_CloseFont(font);
@@ -266,7 +303,7 @@ void SDLRenderer::drawSprite(int srcX, int srcY, int srcW, int srcH,
 
 void SDLRenderer::setSpriteSheet(const std::string& path) {
     // Texture is owned by the cache; just re-point the active sheet
-    spriteSheet_ = loadTexture(path);
+    spriteSheet_ = resolveTexture(loadTexture(path));
 }
 
 } // namespace tank
@@ -95,38 +95,38 @@ void ConstructionState::render(IRenderer& renderer) {
 }
 
 void ConstructionState::handleInput(const IInput& input) {
-    const bool largeBrush = input.isKeyDown(SDL_SCANCODE_LSHIFT) || input.isKeyDown(SDL_SCANCODE_RSHIFT);
+    const bool largeBrush = input.isKeyDown(Scancode::LeftShift) || input.isKeyDown(Scancode::RightShift);
 
     updateHoverFromMouse(input);
     handleMousePaint(input, largeBrush);
 
-    if (input.isKeyPressed(SDL_SCANCODE_TAB)) {
+    if (input.isKeyPressed(Scancode::Tab)) {
         mode_ = (mode_ == EditorMode::Terrain) ? EditorMode::EnemyList : EditorMode::Terrain;
         setStatus(mode_ == EditorMode::Terrain ? "Mode: terrain editor" : "Mode: enemy list editor");
     }
 
     // Navigation
-    if (input.isKeyPressed(SDL_SCANCODE_LEFT)) moveCursor(-1, 0);
-    if (input.isKeyPressed(SDL_SCANCODE_RIGHT)) moveCursor(1, 0);
-    if (input.isKeyPressed(SDL_SCANCODE_UP)) moveCursor(0, -1);
-    if (input.isKeyPressed(SDL_SCANCODE_DOWN)) moveCursor(0, 1);
+    if (input.isKeyPressed(Scancode::Left)) moveCursor(-1, 0);
+    if (input.isKeyPressed(Scancode::Right)) moveCursor(1, 0);
+    if (input.isKeyPressed(Scancode::Up)) moveCursor(0, -1);
+    if (input.isKeyPressed(Scancode::Down)) moveCursor(0, 1);
 
     if (mode_ == EditorMode::Terrain) {
         // Brush selection (0-4)
-        if (input.isKeyPressed(SDL_SCANCODE_0)) brushType_ = TerrainType::Empty;
-        if (input.isKeyPressed(SDL_SCANCODE_1)) brushType_ = TerrainType::Steel;
-        if (input.isKeyPressed(SDL_SCANCODE_2)) brushType_ = TerrainType::Brick;
-        if (input.isKeyPressed(SDL_SCANCODE_3)) brushType_ = TerrainType::Water;
-        if (input.isKeyPressed(SDL_SCANCODE_4)) brushType_ = TerrainType::Grass;
+        if (input.isKeyPressed(Scancode::Num0)) brushType_ = TerrainType::Empty;
+        if (input.isKeyPressed(Scancode::Num1)) brushType_ = TerrainType::Steel;
+        if (input.isKeyPressed(Scancode::Num2)) brushType_ = TerrainType::Brick;
+        if (input.isKeyPressed(Scancode::Num3)) brushType_ = TerrainType::Water;
+        if (input.isKeyPressed(Scancode::Num4)) brushType_ = TerrainType::Grass;
     }
 
     if (mode_ == EditorMode::Terrain) {
         // Paint / erase
-        if (input.isKeyPressed(SDL_SCANCODE_SPACE) || input.isKeyPressed(SDL_SCANCODE_RETURN)) {
+        if (input.isKeyPressed(Scancode::Space) || input.isKeyPressed(Scancode::Return)) {
             paintAtCursor(largeBrush);
         }
-        if (input.isKeyPressed(SDL_SCANCODE_BACKSPACE) || input.isKeyPressed(SDL_SCANCODE_DELETE) ||
-            input.isKeyPressed(SDL_SCANCODE_X)) {
+        if (input.isKeyPressed(Scancode::Backspace) || input.isKeyPressed(Scancode::Delete) ||
+            input.isKeyPressed(Scancode::X)) {
             eraseAtCursor(largeBrush);
         }
     }
@@ -140,42 +140,42 @@ void ConstructionState::handleInput(const IInput& input) {
             selectedEnemyIndex_ = 0;
         }
 
-        if (input.isKeyPressed(SDL_SCANCODE_LEFTBRACKET)) {
+        if (input.isKeyPressed(Scancode::LeftBracket)) {
             selectedEnemyIndex_ = std::max(0, selectedEnemyIndex_ - 1);
         }
-        if (input.isKeyPressed(SDL_SCANCODE_RIGHTBRACKET) && count > 0) {
+        if (input.isKeyPressed(Scancode::RightBracket) && count > 0) {
             selectedEnemyIndex_ = std::min(static_cast<int>(count - 1), selectedEnemyIndex_ + 1);
         }
 
         const size_t idx = static_cast<size_t>(selectedEnemyIndex_);
         bool changed = false;
-        if (input.isKeyPressed(SDL_SCANCODE_1)) changed = level_->setEnemySpawnType(idx, EnemyType::Basic) || changed;
-        if (input.isKeyPressed(SDL_SCANCODE_2)) changed = level_->setEnemySpawnType(idx, EnemyType::Fast) || changed;
-        if (input.isKeyPressed(SDL_SCANCODE_3)) changed = level_->setEnemySpawnType(idx, EnemyType::Power) || changed;
-        if (input.isKeyPressed(SDL_SCANCODE_4)) changed = level_->setEnemySpawnType(idx, EnemyType::Heavy) || changed;
-        if (input.isKeyPressed(SDL_SCANCODE_P)) changed = level_->toggleEnemySpawnPowerUp(idx) || changed;
+        if (input.isKeyPressed(Scancode::Num1)) changed = level_->setEnemySpawnType(idx, EnemyType::Basic) || changed;
+        if (input.isKeyPressed(Scancode::Num2)) changed = level_->setEnemySpawnType(idx, EnemyType::Fast) || changed;
+        if (input.isKeyPressed(Scancode::Num3)) changed = level_->setEnemySpawnType(idx, EnemyType::Power) || changed;
+        if (input.isKeyPressed(Scancode::Num4)) changed = level_->setEnemySpawnType(idx, EnemyType::Heavy) || changed;
+        if (input.isKeyPressed(Scancode::P)) changed = level_->toggleEnemySpawnPowerUp(idx) || changed;
         if (changed) dirty_ = true;
     }
 
     // Level navigation
-    if (input.isKeyPressed(SDL_SCANCODE_PAGEUP)) {
+    if (input.isKeyPressed(Scancode::PageUp)) {
         levelNumber_ = std::max(1, levelNumber_ - 1);
         loadLevel(levelNumber_);
         return;
     }
-    if (input.isKeyPressed(SDL_SCANCODE_PAGEDOWN)) {
+    if (input.isKeyPressed(Scancode::PageDown)) {
         levelNumber_ = std::min(LevelLoader::getTotalLevels(), levelNumber_ + 1);
         loadLevel(levelNumber_);
         return;
     }
 
     // New / reload
-    if (input.isKeyPressed(SDL_SCANCODE_N)) {
+    if (input.isKeyPressed(Scancode::N)) {
         createNewLevel(levelNumber_);
         setStatus("Created blank level");
         return;
     }
-    if (input.isKeyPressed(SDL_SCANCODE_L)) {
+    if (input.isKeyPressed(Scancode::L)) {
         if (!dirty_) {
             loadLevel(levelNumber_);
         } else if (consumeConfirm(ConfirmAction::ReloadLevel)) {
@@ -187,8 +187,8 @@ void ConstructionState::handleInput(const IInput& input) {
     }
 
     // Save (S) -> custom file; Ctrl+S -> overwrite Level_N (double confirm)
-    const bool ctrlDown = input.isKeyDown(SDL_SCANCODE_LCTRL) || input.isKeyDown(SDL_SCANCODE_RCTRL);
-    if (ctrlDown && input.isKeyPressed(SDL_SCANCODE_S)) {
+    const bool ctrlDown = input.isKeyDown(Scancode::LeftCtrl) || input.isKeyDown(Scancode::RightCtrl);
+    if (ctrlDown && input.isKeyPressed(Scancode::S)) {
         if (consumeConfirm(ConfirmAction::OverwriteLevelFile)) {
             overwriteCurrentLevelFile();
         } else {
@@ -196,13 +196,13 @@ void ConstructionState::handleInput(const IInput& input) {
         }
         return;
     }
-    if (!ctrlDown && input.isKeyPressed(SDL_SCANCODE_S)) {
+    if (!ctrlDown && input.isKeyPressed(Scancode::S)) {
         saveToCustomFile();
         return;
     }
 
     // Quick playtest (F5) - saves to Level_custom then starts PlayingState from that file
-    if (input.isKeyPressed(SDL_SCANCODE_F5)) {
+    if (input.isKeyPressed(Scancode::F5)) {
         if (level_) {
             if (saveToCustomFile()) {
                 stateManager_.pushState(std::make_unique<PlayingState>(stateManager_, levelNumber_, false, "assets/levels/Level_custom"));
@@ -212,7 +212,7 @@ void ConstructionState::handleInput(const IInput& input) {
     }
 
     // Exit
-    if (input.isKeyPressed(SDL_SCANCODE_ESCAPE)) {
+    if (input.isKeyPressed(Scancode::Escape)) {
         if (!dirty_) {
             stateManager_.changeToMenu();
             return;
@@ -321,8 +321,8 @@ void ConstructionState::handleMousePaint(const IInput& input, bool largeBrush) {
     if (!level_) return;
     if (hoverX_ < 0 || hoverY_ < 0) return;
 
-    const bool lmbDown = input.isMouseButtonDown(SDL_BUTTON_LEFT);
-    const bool rmbDown = input.isMouseButtonDown(SDL_BUTTON_RIGHT);
+    const bool lmbDown = input.isMouseButtonDown(MouseButton::Left);
+    const bool rmbDown = input.isMouseButtonDown(MouseButton::Right);
     if (!lmbDown && !rmbDown) {
         lastPaintX_ = -1;
         lastPaintY_ = -1;
@@ -330,7 +330,7 @@ void ConstructionState::handleMousePaint(const IInput& input, bool largeBrush) {
         return;
     }
 
-    const uint8_t activeButton = lmbDown ? SDL_BUTTON_LEFT : SDL_BUTTON_RIGHT;
+    const uint8_t activeButton = lmbDown ? MouseButton::Left : MouseButton::Right;
     if (hoverX_ == lastPaintX_ && hoverY_ == lastPaintY_ && activeButton == lastPaintButton_) return;
 
     cursorX_ = hoverX_;
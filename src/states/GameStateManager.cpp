@@ -4,7 +4,6 @@
 #include "states/PlayingState.hpp"
 #include "states/ScoreState.hpp"
 #include "states/ConstructionState.hpp"
-#include "core/ServiceLocator.hpp"
 #include "input/IInput.hpp"
 #include <algorithm>
 #include <iostream>
@@ -94,8 +93,8 @@ bool GameStateManager::loadProgress(const std::string& filePath) {
     if (progress_.masterVolume > 0.0f) {
         volumeBeforeMute_ = progress_.masterVolume;
     }
-    if (ServiceLocator::hasAudio()) {
-        ServiceLocator::getAudio().setMasterVolume(progress_.masterVolume);
+    if (IAudioPlayer* audio = context_.getAudio()) {
+        audio->setMasterVolume(progress_.masterVolume);
     }
     return true;
 }
@@ -128,8 +127,8 @@ void GameStateManager::setMasterVolume(float volume) {
     if (progress_.masterVolume > 0.0f) {
         volumeBeforeMute_ = progress_.masterVolume;
     }
-    if (ServiceLocator::hasAudio()) {
-        ServiceLocator::getAudio().setMasterVolume(progress_.masterVolume);
+    if (IAudioPlayer* audio = context_.getAudio()) {
+        audio->setMasterVolume(progress_.masterVolume);
     }
     saveProgress();
 }
@@ -188,12 +187,19 @@ void GameStateManager::update(float deltaTime) {
     }
 }
 
-void GameStateManager::render(IRenderer& renderer) {
+void GameStateManager::render(IRenderer& renderer, float alpha) {
     if (!states_.empty()) {
-        states_.top()->render(renderer);
+        states_.top()->renderInterpolated(renderer, alpha);
     }
 }
 
+float GameStateManager::getIdleRedrawInterval() const {
+    if (states_.empty() || pendingPush_ || pendingPop_ || pendingChange_) {
+        return 0.0f;
+    }
+    return states_.top()->getIdleRedrawInterval();
+}
+
 void GameStateManager::handleInput(const IInput& input) {
     if (!states_.empty()) {
         states_.top()->handleInput(input);
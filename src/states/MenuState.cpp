@@ -1,19 +1,35 @@
 #include "states/MenuState.hpp"
 #include "states/GameStateManager.hpp"
-#include "core/ServiceLocator.hpp"
 #include "graphics/SpriteSheet.hpp"
 #include "input/IInput.hpp"
 #include <iostream>
+#include <algorithm>
 #include <cmath>
 
 namespace tank {
 
 namespace {
 
-void playMenuSfx(SoundId id) {
-    if (ServiceLocator::hasAudio()) {
-        ServiceLocator::getAudio().playSound(id);
+constexpr float TWO_PI = 6.28318530718f;
+
+// Phase still to go from phase until trunc(sin * amplitude) next changes,
+// i.e. until sin crosses the next multiple of 1 / amplitude. The full
+// amplitude is only touched at the crests and is not woken for.
+float phaseToNextBounceStep(float phase, float amplitude) {
+    phase = std::fmod(phase, TWO_PI);
+    float nearest = TWO_PI;
+    const int steps = static_cast<int>(std::ceil(amplitude)) - 1;
+    for (int step = -steps; step <= steps; ++step) {
+        const float base = std::asin(step / amplitude);
+        for (float crossing : {base, 3.14159265359f - base}) {
+            float ahead = std::fmod(crossing - phase, TWO_PI);
+            if (ahead <= 1e-4f) {
+                ahead += TWO_PI;
+            }
+            nearest = std::min(nearest, ahead);
+        }
     }
+    return nearest;
 }
 
 } // namespace
@@ -30,9 +46,7 @@ void MenuState::enter() {
     fadeAlpha_ = 0.0f;
     cursorPulse_ = 0.0f;
 
-    if (ServiceLocator::hasAudio()) {
-        ServiceLocator::getAudio().playMusic("assets/audio/music/menu_theme.wav", true);
-    }
+    stateManager_.getContext().playMusic("assets/audio/music/menu_theme.wav");
 }
 
 void MenuState::exit() {
@@ -41,7 +55,7 @@ void MenuState::exit() {
 void MenuState::update(float deltaTime) {
     // Animation timers
     animTimer_ += deltaTime;
-    cursorPulse_ += deltaTime * 5.0f;
+    cursorPulse_ += deltaTime * CURSOR_PULSE_SPEED;
 
     // Fade in effect
     if (fadeAlpha_ < 1.0f) {
@@ -50,6 +64,18 @@ void MenuState::update(float deltaTime) {
     }
 }
 
+float MenuState::getIdleRedrawInterval() const {
+    if (fadeAlpha_ < 1.0f) {
+        return 0.0f;
+    }
+    // After the fade-in only the icon treads and the cursor bounce change on
+    // their own; wake for whichever moves a pixel first.
+    const float nextIconFrame = ICON_FRAME_SECONDS - std::fmod(animTimer_, ICON_FRAME_SECONDS);
+    const float nextBounceStep =
+        phaseToNextBounceStep(cursorPulse_, CURSOR_BOUNCE_PIXELS) / CURSOR_PULSE_SPEED;
+    return std::min(nextIconFrame, nextBounceStep);
+}
+
 void MenuState::render(IRenderer& renderer) {
     renderBackground(renderer);
     renderTitle(renderer);
@@ -179,7 +205,7 @@ void MenuState::renderPlayerMode(IRenderer& renderer) {
     const int groupWidth = iconsWidth + TEXT_GAP + textWidth;
     const int groupX = (Constants::WINDOW_WIDTH - groupWidth) / 2;
     const int tankY = modeY + (TEXT_SIZE - ICON_SIZE) / 2;
-    const int animFrame = static_cast<int>(animTimer_ * 4.0f) % 2;
+    const int animFrame = static_cast<int>(animTimer_ / ICON_FRAME_SECONDS) % 2;
 
     const Rectangle p1Sprite = Sprites::Tank::getFrame(
         Sprites::Tank::P1_BASE_Y, Sprites::Tank::DIR_UP_COL, animFrame, 0);
@@ -224,7 +250,7 @@ void MenuState::renderMuteButton(IRenderer& renderer) {
 
 void MenuState::renderCursor(IRenderer& renderer, int x, int y) {
     // Keep navigation separate from the visual player count.
-    float bounce = std::sin(cursorPulse_) * 3.0f;
+    float bounce = std::sin(cursorPulse_) * CURSOR_BOUNCE_PIXELS;
     const int cursorX = x + static_cast<int>(bounce);
     renderer.drawText(">", Vector2(static_cast<float>(cursorX), static_cast<float>(y - 3)),
                      Constants::UIColors::MENU_HIGHLIGHT, 22);
@@ -249,15 +275,15 @@ void MenuState::renderFooter(IRenderer& renderer) {
 }
 
 void MenuState::handleInput(const IInput& input) {
-    const bool muteClick = input.isMouseButtonPressed(SDL_BUTTON_LEFT) &&
+    const bool muteClick = input.isMouseButtonPressed(MouseButton::Left) &&
         input.getMouseX() >= MUTE_BUTTON_X &&
         input.getMouseX() < MUTE_BUTTON_X + MUTE_BUTTON_WIDTH &&
         input.getMouseY() >= MUTE_BUTTON_Y &&
         input.getMouseY() < MUTE_BUTTON_Y + MUTE_BUTTON_HEIGHT;
-    if (input.isKeyPressed(SDL_SCANCODE_M) || muteClick) {
+    if (input.isKeyPressed(Scancode::M) || muteClick) {
         stateManager_.toggleMute();
         if (!stateManager_.isMuted()) {
-            playMenuSfx(SoundId::MenuConfirm);
+            stateManager_.getContext().playSound(SoundId::MenuConfirm);
         }
         return;
     }
@@ -267,47 +293,47 @@ void MenuState::handleInput(const IInput& input) {
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_C)) {
+    if (input.isKeyPressed(Scancode::C)) {
         stateManager_.changeToConstruction(1);
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_P)) {
+    if (input.isKeyPressed(Scancode::P)) {
         twoPlayerMode_ = !twoPlayerMode_;
         return;
     }
 
     // Direct mode selection via number keys
-    if (input.isKeyPressed(SDL_SCANCODE_1)) {
+    if (input.isKeyPressed(Scancode::Num1)) {
         selectedItem_ = MenuItem::Campaign;
-        playMenuSfx(SoundId::MenuConfirm);
+        stateManager_.getContext().playSound(SoundId::MenuConfirm);
         confirmSelection();
         return;
     }
-    if (input.isKeyPressed(SDL_SCANCODE_2)) {
+    if (input.isKeyPressed(Scancode::Num2)) {
         selectedItem_ = MenuItem::Survival;
-        playMenuSfx(SoundId::MenuConfirm);
+        stateManager_.getContext().playSound(SoundId::MenuConfirm);
         confirmSelection();
         return;
     }
-    if (input.isKeyPressed(SDL_SCANCODE_3)) {
+    if (input.isKeyPressed(Scancode::Num3)) {
         selectedItem_ = MenuItem::Settings;
         confirmSelection();
         return;
     }
 
     // Navigate
-    if (input.isKeyPressed(SDL_SCANCODE_UP) || input.isKeyPressed(SDL_SCANCODE_W)) {
+    if (input.isKeyPressed(Scancode::Up) || input.isKeyPressed(Scancode::W)) {
         selectPreviousItem();
-        playMenuSfx(SoundId::MenuMove);
-    } else if (input.isKeyPressed(SDL_SCANCODE_DOWN) || input.isKeyPressed(SDL_SCANCODE_S)) {
+        stateManager_.getContext().playSound(SoundId::MenuMove);
+    } else if (input.isKeyPressed(Scancode::Down) || input.isKeyPressed(Scancode::S)) {
         selectNextItem();
-        playMenuSfx(SoundId::MenuMove);
+        stateManager_.getContext().playSound(SoundId::MenuMove);
     }
 
     // Confirm
-    if (input.isKeyPressed(SDL_SCANCODE_RETURN) || input.isKeyPressed(SDL_SCANCODE_SPACE)) {
-        playMenuSfx(SoundId::MenuConfirm);
+    if (input.isKeyPressed(Scancode::Return) || input.isKeyPressed(Scancode::Space)) {
+        stateManager_.getContext().playSound(SoundId::MenuConfirm);
         confirmSelection();
     }
 }
@@ -346,21 +372,21 @@ void MenuState::confirmSelection() {
 }
 
 void MenuState::handleSettingsInput(const IInput& input) {
-    if (input.isKeyPressed(SDL_SCANCODE_ESCAPE)) {
+    if (input.isKeyPressed(Scancode::Escape)) {
         settingsOpen_ = false;
         return;
     }
 
     int selected = static_cast<int>(selectedSettingsItem_);
-    if (input.isKeyPressed(SDL_SCANCODE_UP) || input.isKeyPressed(SDL_SCANCODE_W)) {
+    if (input.isKeyPressed(Scancode::Up) || input.isKeyPressed(Scancode::W)) {
         selected = (selected + 2) % 3;
-    } else if (input.isKeyPressed(SDL_SCANCODE_DOWN) || input.isKeyPressed(SDL_SCANCODE_S)) {
+    } else if (input.isKeyPressed(Scancode::Down) || input.isKeyPressed(Scancode::S)) {
         selected = (selected + 1) % 3;
     }
     selectedSettingsItem_ = static_cast<SettingsItem>(selected);
 
-    const bool decrease = input.isKeyPressed(SDL_SCANCODE_LEFT) || input.isKeyPressed(SDL_SCANCODE_A);
-    const bool increase = input.isKeyPressed(SDL_SCANCODE_RIGHT) || input.isKeyPressed(SDL_SCANCODE_D);
+    const bool decrease = input.isKeyPressed(Scancode::Left) || input.isKeyPressed(Scancode::A);
+    const bool increase = input.isKeyPressed(Scancode::Right) || input.isKeyPressed(Scancode::D);
     if (selectedSettingsItem_ == SettingsItem::Volume && (decrease || increase)) {
         const float delta = decrease ? -0.1f : 0.1f;
         stateManager_.setMasterVolume(stateManager_.getMasterVolume() + delta);
@@ -1,23 +1,22 @@
 #include "states/PlayingState.hpp"
 #include "states/GameStateManager.hpp"
-#include "collision/handlers/BulletTerrainHandler.hpp"
 #include "collision/handlers/BulletTankHandler.hpp"
-#include "collision/handlers/TankTerrainHandler.hpp"
 #include "collision/handlers/TankTankHandler.hpp"
 #include "collision/handlers/BulletBulletHandler.hpp"
 #include "entities/effects/Effect.hpp"
-#include "entities/terrain/Water.hpp"
 #include "input/IInput.hpp"
 #include "input/PlayerInput.hpp"
 #include "level/EnemyWaveGenerator.hpp"
 #include "graphics/SpriteSheet.hpp"
 #include "utils/DamageCalculator.hpp"
 #include "ai/AIBehavior.hpp"
-#include "core/ServiceLocator.hpp"
 #include <array>
+#include <optional>
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <random>
-#include <unordered_map>
 #include <unordered_set>
 
 namespace tank {
@@ -27,36 +26,24 @@ constexpr float SPAWN_INTERVAL_SECONDS = Constants::ENEMY_SPAWN_INTERVAL / 1000.
 
 namespace {
 
-void playSfx(SoundId id) {
-    if (ServiceLocator::hasAudio()) {
-        ServiceLocator::getAudio().playSound(id);
-    }
-}
-
-void playMusicTrack(const std::string& path) {
-    if (ServiceLocator::hasAudio()) {
-        ServiceLocator::getAudio().playMusic(path, true);
-    }
-}
-
 PlayerInput readPlayer1Input(const IInput& input) {
     PlayerInput playerInput;
-    playerInput.up = input.isKeyDown(SDL_SCANCODE_W);
-    playerInput.down = input.isKeyDown(SDL_SCANCODE_S);
-    playerInput.left = input.isKeyDown(SDL_SCANCODE_A);
-    playerInput.right = input.isKeyDown(SDL_SCANCODE_D);
-    playerInput.fire = input.isKeyDown(SDL_SCANCODE_SPACE);
+    playerInput.up = input.isKeyDown(Scancode::W);
+    playerInput.down = input.isKeyDown(Scancode::S);
+    playerInput.left = input.isKeyDown(Scancode::A);
+    playerInput.right = input.isKeyDown(Scancode::D);
+    playerInput.fire = input.isKeyDown(Scancode::Space);
     return playerInput;
 }
 
 PlayerInput readPlayer2Input(const IInput& input) {
     PlayerInput playerInput;
-    playerInput.up = input.isKeyDown(SDL_SCANCODE_UP);
-    playerInput.down = input.isKeyDown(SDL_SCANCODE_DOWN);
-    playerInput.left = input.isKeyDown(SDL_SCANCODE_LEFT);
-    playerInput.right = input.isKeyDown(SDL_SCANCODE_RIGHT);
-    playerInput.fire = input.isKeyDown(SDL_SCANCODE_RETURN) || input.isKeyDown(SDL_SCANCODE_KP_ENTER) ||
-                       input.isKeyDown(SDL_SCANCODE_RCTRL);
+    playerInput.up = input.isKeyDown(Scancode::Up);
+    playerInput.down = input.isKeyDown(Scancode::Down);
+    playerInput.left = input.isKeyDown(Scancode::Left);
+    playerInput.right = input.isKeyDown(Scancode::Right);
+    playerInput.fire = input.isKeyDown(Scancode::Return) || input.isKeyDown(Scancode::KeypadEnter) ||
+                       input.isKeyDown(Scancode::RightCtrl);
     return playerInput;
 }
 
@@ -65,9 +52,10 @@ Vector2 centeredEffectTopLeft(const Rectangle& bounds, float effectSize) {
     return Vector2(center.x - effectSize / 2.0f, center.y - effectSize / 2.0f);
 }
 
-std::mt19937& powerUpRandom() {
-    static std::mt19937 generator(std::random_device{}());
-    return generator;
+// Tag-checked lookup; null for enemies, destroyed owners and non-tanks
+PlayerTank* resolvePlayerTank(const EntityWorld& world, EntityHandle handle) {
+    IEntity* entity = world.getHandles().get(handle);
+    return entity && entity->getKind() == EntityKind::PlayerTank ? static_cast<PlayerTank*>(entity) : nullptr;
 }
 } // namespace
 
@@ -77,6 +65,7 @@ PlayingState::PlayingState(GameStateManager& manager, int levelNumber, bool twoP
     , twoPlayerMode_(twoPlayer)
     , useWaveGenerator_(useWaveGenerator)
     , levelFilePath_()
+    , powerUpManager_(world_)
     , paused_(false)
     , gameOver_(false)
     , levelComplete_(false)
@@ -90,6 +79,7 @@ PlayingState::PlayingState(GameStateManager& manager, int levelNumber, bool twoP
     , hud_()
     , gameOverOverlay_()
     , pauseOverlay_()
+    , random_(std::random_device{}())
 {
     // Initialize HUD
     hud_.setTwoPlayerMode(twoPlayerMode_);
@@ -105,14 +95,13 @@ PlayingState::PlayingState(GameStateManager& manager, int levelNumber, bool twoP
 void PlayingState::enter() {
     setupCollisionHandlers();
     loadLevel();
-    playMusicTrack("assets/audio/music/battle_theme.wav");
+    stateManager_.getContext().playMusic("assets/audio/music/battle_theme.wav");
 }
 
 void PlayingState::exit() {
-    detachAllBulletOwners();
     bullets_.clear();
     enemies_.clear();
-    terrains_.clear();
+    clearTerrain();
     effects_.clear();
     powerUpManager_.clear();
     player1_.reset();
@@ -126,6 +115,10 @@ void PlayingState::loadLevel() {
     } else {
         level_ = levelLoader_.loadLevel(currentLevel_);
     }
+    levelLoadFailed_ = !level_ && !defaultLevelFallback_;
+    if (levelLoadFailed_) {
+        return;
+    }
     if (!level_) {
         // Create default level if load fails
         level_ = std::make_unique<Level>(currentLevel_);
@@ -158,78 +151,95 @@ void PlayingState::loadLevel() {
 }
 
 void PlayingState::createTerrain() {
-    terrains_.clear();
-
-    const auto& terrainMap = level_->getTerrainMap();
-
     const int width = level_->getWidth();
     const int height = level_->getHeight();
+    terrainMap_.reset(width, height);
+    tankBlockingBits_.reset(width * Constants::CELL_SIZE, height * Constants::CELL_SIZE);
+    bulletBlockingBits_.reset(width * Constants::CELL_SIZE, height * Constants::CELL_SIZE);
+    waterAnimationTimer_ = 0.0f;
+    waterFrame_ = 0;
 
-    // Brick walls are rendered as 2x2 half-cells (34x34) with 4-corner state (classic Battle City).
-    for (int y = 0; y + 1 < height; y += 2) {
-        for (int x = 0; x + 1 < width; x += 2) {
-            const std::array<bool, 4> corners = {
-                terrainMap[y][x] == TerrainType::Brick,
-                terrainMap[y][x + 1] == TerrainType::Brick,
-                terrainMap[y + 1][x] == TerrainType::Brick,
-                terrainMap[y + 1][x + 1] == TerrainType::Brick
-            };
-
-            if (corners[0] || corners[1] || corners[2] || corners[3]) {
-                const int posX = x * Constants::CELL_SIZE;
-                const int posY = y * Constants::CELL_SIZE;
-                terrains_.push_back(std::make_unique<BrickWall>(
-                    Vector2(static_cast<float>(posX), static_cast<float>(posY)),
-                    corners));
-            }
-        }
-    }
-
-    // Other terrain remains half-cell based (17x17) for now.
+    // A copy of the level's cells; the base is a separate entity
+    const auto& terrainMap = level_->getTerrainMap();
     for (int y = 0; y < height; ++y) {
         for (int x = 0; x < width; ++x) {
             const TerrainType type = terrainMap[y][x];
-            if (type == TerrainType::Brick) {
+            if (type == TerrainType::Empty || type == TerrainType::Base) {
                 continue;
             }
-
-            const int posX = x * Constants::CELL_SIZE;
-            const int posY = y * Constants::CELL_SIZE;
-
-            switch (type) {
-                case TerrainType::Steel:
-                    terrains_.push_back(std::make_unique<SteelWall>(
-                        Vector2(static_cast<float>(posX), static_cast<float>(posY))));
-                    break;
-                case TerrainType::Water:
-                    terrains_.push_back(std::make_unique<Water>(
-                        Vector2(static_cast<float>(posX), static_cast<float>(posY))));
-                    break;
-                case TerrainType::Grass:
-                    terrains_.push_back(std::make_unique<Grass>(
-                        Vector2(static_cast<float>(posX), static_cast<float>(posY))));
-                    break;
-                default:
-                    break;
+            terrainMap_.set(x, y, type);
+            const TerrainMaterial& material = getTerrainMaterial(type);
+            const Rectangle bounds = TerrainMap::getCellBounds({x, y});
+            if (material.blocksTanks) {
+                tankBlockingBits_.fill(bounds);
+            }
+            if (material.blocksBullets) {
+                bulletBlockingBits_.fill(bounds);
             }
         }
     }
+    tankClearance_.rebuild(tankBlockingBits_);
+    bulletLanes_.invalidateAll();
 
     // Create base
     Vector2 basePos = level_->getBasePosition();
-    base_ = std::make_unique<Base>(static_cast<int>(basePos.x), static_cast<int>(basePos.y));
+    base_ = std::make_unique<Base>(world_, static_cast<int>(basePos.x), static_cast<int>(basePos.y));
+}
+
+void PlayingState::setTerrainCell(int x, int y, TerrainType material) {
+    if (!terrainMap_.contains(x, y) || terrainMap_.get(x, y) == material) {
+        return;
+    }
+    terrainMap_.set(x, y, material);
+    // Written through so the level never has to be synced back from the
+    // live map
+    if (level_) {
+        level_->setTerrainAt(x, y, material);
+    }
+
+    const TerrainMaterial& traits = getTerrainMaterial(material);
+    const Rectangle bounds = TerrainMap::getCellBounds({x, y});
+    if (traits.blocksTanks) {
+        tankBlockingBits_.fill(bounds);
+    } else {
+        tankBlockingBits_.erase(bounds);
+    }
+    if (traits.blocksBullets) {
+        bulletBlockingBits_.fill(bounds);
+    } else {
+        bulletBlockingBits_.erase(bounds);
+    }
+    tankClearance_.update(tankBlockingBits_, bounds);
+    bulletLanes_.invalidate(bounds);
+}
+
+void PlayingState::clearTerrain() {
+    if (level_) {
+        for (int y = 0; y < terrainMap_.getHeight(); ++y) {
+            for (int x = 0; x < terrainMap_.getWidth(); ++x) {
+                if (terrainMap_.get(x, y) != TerrainType::Empty) {
+                    level_->setTerrainAt(x, y, TerrainType::Empty);
+                }
+            }
+        }
+    }
+    terrainMap_.clear();
+    tankBlockingBits_.clear();
+    bulletBlockingBits_.clear();
+    tankClearance_.rebuild(tankBlockingBits_);
+    bulletLanes_.invalidateAll();
 }
 
 void PlayingState::createPlayers() {
     Vector2 spawn1 = level_->getPlayer1Spawn();
-    player1_ = std::make_unique<PlayerTank>(1, spawn1);
+    player1_ = std::make_unique<PlayerTank>(world_, 1, spawn1);
     // Restore saved level
     player1_->setLevel(stateManager_.getPlayer1Level());
     player1_->addScore(stateManager_.getPlayerScore(1));
 
     if (twoPlayerMode_) {
         Vector2 spawn2 = level_->getPlayer2Spawn();
-        player2_ = std::make_unique<PlayerTank>(2, spawn2);
+        player2_ = std::make_unique<PlayerTank>(world_, 2, spawn2);
         // Restore saved level
         player2_->setLevel(stateManager_.getPlayer2Level());
         player2_->addScore(stateManager_.getPlayerScore(2));
@@ -238,13 +248,22 @@ void PlayingState::createPlayers() {
 
 void PlayingState::setupCollisionHandlers() {
     collisionManager_.addHandler(std::make_unique<BulletBulletHandler>());
-    collisionManager_.addHandler(std::make_unique<BulletTerrainHandler>());
     collisionManager_.addHandler(std::make_unique<BulletTankHandler>());
-    collisionManager_.addHandler(std::make_unique<TankTerrainHandler>());
     collisionManager_.addHandler(std::make_unique<TankTankHandler>());
+
+    // Only players collect power-ups, and bullets fly over them
+    broadphase_.setPairFilter(EntityKind::PowerUp, EntityKind::PowerUp, false);
+    broadphase_.setPairFilter(EntityKind::PowerUp, EntityKind::EnemyTank, false);
+    broadphase_.setPairFilter(EntityKind::PowerUp, EntityKind::Bullet, false);
 }
 
 void PlayingState::update(float deltaTime) {
+    // Also while paused, so a frozen world is not drawn mid-blend
+    snapshotTransforms();
+
+    // Nothing was loaded to play
+    if (levelLoadFailed_) return;
+
     // Update game over animation even when game is over
     if (gameOver_) {
         gameOverOverlay_.update(deltaTime);
@@ -275,6 +294,42 @@ void PlayingState::update(float deltaTime) {
     checkGameState(deltaTime);
 }
 
+void PlayingState::snapshotTransforms() {
+    if (player1_) {
+        player1_->snapshotTransform();
+    }
+    if (player2_) {
+        player2_->snapshotTransform();
+    }
+    for (auto& enemy : enemies_) {
+        enemy->snapshotTransform();
+    }
+    for (auto& bullet : bullets_) {
+        bullet->snapshotTransform();
+    }
+    for (auto& effect : effects_) {
+        effect->snapshotTransform();
+    }
+}
+
+void PlayingState::setRenderAlpha(float alpha) {
+    if (player1_) {
+        player1_->setRenderAlpha(alpha);
+    }
+    if (player2_) {
+        player2_->setRenderAlpha(alpha);
+    }
+    for (auto& enemy : enemies_) {
+        enemy->setRenderAlpha(alpha);
+    }
+    for (auto& bullet : bullets_) {
+        bullet->setRenderAlpha(alpha);
+    }
+    for (auto& effect : effects_) {
+        effect->setRenderAlpha(alpha);
+    }
+}
+
 void PlayingState::updateEntities(float deltaTime) {
     // Update players
     if (player1_ && player1_->isAlive()) {
@@ -296,18 +351,13 @@ void PlayingState::updateEntities(float deltaTime) {
         }
     }
 
-    // Update bullets
-    for (auto& bullet : bullets_) {
-        if (bullet->isAlive()) {
-            bullet->update(deltaTime);
-        }
-    }
+    // Update bullets: one pass over the store's arrays
+    world_.getBulletStore().advance();
 
-    // Update terrain (ITerrain interface provides update())
-    for (auto& terrain : terrains_) {
-        if (terrain->isActive()) {
-            terrain->update(deltaTime);
-        }
+    waterAnimationTimer_ += deltaTime;
+    if (waterAnimationTimer_ >= WATER_FRAME_DURATION) {
+        waterAnimationTimer_ = 0.0f;
+        waterFrame_ = (waterFrame_ + 1) % 2;
     }
 
     if (base_) {
@@ -333,7 +383,11 @@ void PlayingState::updateEffects(float deltaTime) {
 }
 
 void PlayingState::checkCollisions() {
-    std::vector<Bullet*> bulletsAliveAtStart;
+    // Last tick's scratch is dead by now; everything below draws from here
+    frameArena_.reset();
+    const FrameAllocator<char> scratch(frameArena_);
+
+    FrameVector<Bullet*> bulletsAliveAtStart(scratch);
     bulletsAliveAtStart.reserve(bullets_.size());
     for (auto& bullet : bullets_) {
         if (bullet->isAlive()) {
@@ -341,7 +395,7 @@ void PlayingState::checkCollisions() {
         }
     }
 
-    std::vector<ITank*> tanksAliveAtStart;
+    FrameVector<ITank*> tanksAliveAtStart(scratch);
     tanksAliveAtStart.reserve(enemies_.size() + 2);
     if (player1_ && player1_->isAlive()) {
         tanksAliveAtStart.push_back(player1_.get());
@@ -355,174 +409,419 @@ void PlayingState::checkCollisions() {
         }
     }
 
-    // Collect tanks and save positions before terrain collision
-    std::vector<Tank*> allTanks;
-    std::unordered_map<Tank*, Vector2> positionsBeforeTerrain;
+    // Collect tanks and save positions before terrain collision;
+    // positionsBeforeTerrain[i] belongs to allTanks[i]
+    TankList allTanks(scratch);
+    FrameVector<Vector2> positionsBeforeTerrain(scratch);
+    allTanks.reserve(enemies_.size() + 2);
+    positionsBeforeTerrain.reserve(enemies_.size() + 2);
     if (player1_ && player1_->isAlive() && !player1_->isSpawning()) {
         allTanks.push_back(player1_.get());
-        positionsBeforeTerrain[player1_.get()] = player1_->getPreviousPosition();
+        positionsBeforeTerrain.push_back(player1_->getPreviousPosition());
     }
     if (player2_ && player2_->isAlive() && !player2_->isSpawning()) {
         allTanks.push_back(player2_.get());
-        positionsBeforeTerrain[player2_.get()] = player2_->getPreviousPosition();
+        positionsBeforeTerrain.push_back(player2_->getPreviousPosition());
     }
     for (auto& enemy : enemies_) {
         if (enemy->isAlive() && !enemy->isSpawning()) {
             allTanks.push_back(enemy.get());
-            positionsBeforeTerrain[enemy.get()] = enemy->getPreviousPosition();
+            positionsBeforeTerrain.push_back(enemy->getPreviousPosition());
         }
     }
 
     // Tank vs Terrain collisions (must happen before any other checks)
     checkTankTerrainCollisions();
 
-    // Check tank-to-tank collisions
+    // Broadphase. A tank's box spans everywhere it may be put back to this
+    // tick and a bullet's its whole segment, so each candidate list is a
+    // superset of what the narrow phase below can hit.
+    broadphase_.beginFrame();
     for (size_t i = 0; i < allTanks.size(); ++i) {
-        Tank* tankA = allTanks[i];
-        if (!tankA->isAlive()) continue;
-
-        for (size_t j = i + 1; j < allTanks.size(); ++j) {
-            Tank* tankB = allTanks[j];
-            if (!tankB->isAlive()) continue;
-
-            // Check collision after terrain handling
-            if (CollisionManager::checkAABB(tankA->getBounds(), tankB->getBounds())) {
-                // Check if tanks are moving towards each other
-                Vector2 posA = tankA->getPosition();
-                Vector2 posB = tankB->getPosition();
-                Vector2 prevA = positionsBeforeTerrain[tankA];
-                Vector2 prevB = positionsBeforeTerrain[tankB];
-
-                // Tank A moved towards Tank B (movement direction points towards B's previous position)
-                bool aMovesToB = (posA.x != prevA.x && (posA.x - prevA.x) * (posB.x - prevA.x) > 0) ||
-                                  (posA.y != prevA.y && (posA.y - prevA.y) * (posB.y - prevA.y) > 0);
-                // Tank B moved towards Tank A (movement direction points towards A's previous position)
-                bool bMovesToA = (posB.x != prevB.x && (posB.x - prevB.x) * (posA.x - prevB.x) > 0) ||
-                                  (posB.y != prevB.y && (posB.y - prevB.y) * (posA.y - prevB.y) > 0);
-
-                // Only restore tanks that moved towards the other
-                if (aMovesToB) {
-                    tankA->setPosition(prevA);
-                }
-                if (bMovesToA) {
-                    tankB->setPosition(prevB);
-                }
-            }
-        }
-    }
-
-    // Bullets vs Base
-    if (base_ && base_->isAlive()) {
-        for (auto& bullet : bullets_) {
-            if (bullet->isAlive() && CollisionManager::checkAABB(bullet->getBounds(), base_->getBounds())) {
-                base_->takeDamage(bullet->getAttack(), bullet->getBounds());
-                bullet->hit();
-                bullet->die();
-            }
+        Tank* tank = allTanks[i];
+        if (!tank->isAlive()) continue;
+        const Vector2 back = positionsBeforeTerrain[i] - tank->getPosition();
+        broadphase_.submit(SweepAndPrune::makeKey(tank->getKind(), tank->getId()), tank->getKind(),
+                           static_cast<int>(i), tank->getBounds().swept(back));
+    }
+    for (size_t i = 0; i < bullets_.size(); ++i) {
+        const Bullet& bullet = *bullets_[i];
+        if (!bullet.isAlive()) continue;
+        broadphase_.submit(SweepAndPrune::makeKey(EntityKind::Bullet, bullet.getId()), EntityKind::Bullet,
+                           static_cast<int>(i), bullet.getSegmentStartBounds().swept(bullet.getSegmentDelta()));
+    }
+    const auto& powerUps = powerUpManager_.getPowerUps();
+    for (size_t i = 0; i < powerUps.size(); ++i) {
+        const PowerUp& powerUp = *powerUps[i];
+        if (!powerUp.isActive() || powerUp.isExpired()) continue;
+        broadphase_.submit(SweepAndPrune::makeKey(EntityKind::PowerUp, powerUp.getId()), EntityKind::PowerUp,
+                           static_cast<int>(i), powerUp.getBounds());
+    }
+
+    broadphase_.findPairs(broadphasePairs_);
+
+    // Split by kind; each list ends up in the order the all-pairs loops used
+    IndexPairs tankPairs(scratch);
+    IndexPairs bulletTankPairs(scratch);  // (bullet, tank)
+    IndexPairs bulletPairs(scratch);
+    tankPairs.reserve(broadphasePairs_.size());
+    bulletTankPairs.reserve(broadphasePairs_.size());
+    bulletPairs.reserve(broadphasePairs_.size());
+    std::array<bool, 2> playerNearPowerUp{false, false};
+    for (const auto& pair : broadphasePairs_) {
+        const auto a = static_cast<size_t>(pair.indexA);
+        const auto b = static_cast<size_t>(pair.indexB);
+        if (isTankKind(pair.kindA) && isTankKind(pair.kindB)) {
+            tankPairs.emplace_back(std::min(a, b), std::max(a, b));
+        } else if (isTankKind(pair.kindA) && pair.kindB == EntityKind::Bullet) {
+            bulletTankPairs.emplace_back(b, a);
+        } else if (pair.kindA == EntityKind::Bullet && pair.kindB == EntityKind::Bullet) {
+            bulletPairs.emplace_back(a, b);
+        } else if (pair.kindA == EntityKind::PlayerTank && pair.kindB == EntityKind::PowerUp) {
+            playerNearPowerUp[allTanks[a] == player1_.get() ? 0 : 1] = true;
         }
     }
+    std::sort(tankPairs.begin(), tankPairs.end());
+    std::sort(bulletTankPairs.begin(), bulletTankPairs.end());
 
-    // Bullets vs Terrain (using ITerrain interface directly)
-    for (auto& bullet : bullets_) {
-        if (!bullet->isAlive()) continue;
-
-        const Rectangle bulletBounds = bullet->getBounds();
-        for (auto& terrain : terrains_) {
-            if (terrain->isBulletPassable()) continue;
-            if (terrain->isDestroyed()) continue;
-
-            // ITerrain provides getBounds() directly
-            if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-                if (!brick->intersectsSolid(bulletBounds)) {
-                    continue;
-                }
-                brick->takeDamage(bullet->getAttack(), bulletBounds);
-                playSfx(SoundId::BrickBreak);
-                bullet->hit();
-                bullet->die();
-                break;
-            }
-            if (auto* steel = dynamic_cast<SteelWall*>(terrain.get())) {
-                steel->setDestructible(bullet->getLevel() >= 3);
+    // Check tank-to-tank collisions
+    for (const auto& [i, j] : tankPairs) {
+        Tank* tankA = allTanks[i];
+        Tank* tankB = allTanks[j];
+        if (!tankA->isAlive() || !tankB->isAlive()) continue;
+
+        // Check collision after terrain handling
+        if (CollisionManager::checkAABB(tankA->getBounds(), tankB->getBounds())) {
+            // Check if tanks are moving towards each other
+            Vector2 posA = tankA->getPosition();
+            Vector2 posB = tankB->getPosition();
+            Vector2 prevA = positionsBeforeTerrain[i];
+            Vector2 prevB = positionsBeforeTerrain[j];
+
+            // Tank A moved towards Tank B (movement direction points towards B's previous position)
+            bool aMovesToB = (posA.x != prevA.x && (posA.x - prevA.x) * (posB.x - prevA.x) > 0) ||
+                              (posA.y != prevA.y && (posA.y - prevA.y) * (posB.y - prevA.y) > 0);
+            // Tank B moved towards Tank A (movement direction points towards A's previous position)
+            bool bMovesToA = (posB.x != prevB.x && (posB.x - prevB.x) * (posA.x - prevB.x) > 0) ||
+                              (posB.y != prevB.y && (posB.y - prevB.y) * (posA.y - prevB.y) > 0);
+
+            // Only restore tanks that moved towards the other
+            if (aMovesToB) {
+                tankA->setPosition(prevA);
             }
-            if (CollisionManager::checkAABB(bulletBounds, terrain->getBounds())) {
-                terrain->takeDamage(bullet->getAttack(), bulletBounds);
-                bullet->hit();
-                bullet->die();
-                break;
+            if (bMovesToA) {
+                tankB->setPosition(prevB);
             }
         }
     }
 
-    // Bullets vs Tanks (reuse allTanks from tank-tank collision check above)
-    for (auto& bullet : bullets_) {
-        if (!bullet->isAlive()) continue;
-
-        for (auto* tank : allTanks) {
-            if (!tank->isAlive()) continue;
-            if (bullet->getOwner() == tank) continue;
-
-            if (CollisionManager::checkAABB(bullet->getBounds(), tank->getBounds())) {
-                // Check friendly fire
-                bool bulletFromPlayer = dynamic_cast<PlayerTank*>(bullet->getOwner()) != nullptr;
-                bool targetIsPlayer = dynamic_cast<PlayerTank*>(tank) != nullptr;
-
-                if (bulletFromPlayer != targetIsPlayer) {
-                    // Check invincibility
-                    if (auto* player = dynamic_cast<PlayerTank*>(tank)) {
-                        if (player->isInvincible()) {
-                            bullet->die();
-                            continue;
-                        }
-                    }
-
-                    // Apply damage using DamageCalculator
-                    int damage = DamageCalculator::calculateDamage(
-                        bullet->getAttack(), tank->getDefense(), tank->getMaxHealth());
-                    tank->takeDamage(damage);
-                    playSfx(dynamic_cast<PlayerTank*>(tank) ? SoundId::PlayerDamage : SoundId::TankHit);
-                    if (!tank->isAlive()) {
-                        if (auto* enemy = dynamic_cast<EnemyTank*>(tank)) {
-                            registerEnemyDefeat(*enemy, dynamic_cast<PlayerTank*>(bullet->getOwner()), bullet.get());
-                        }
-                    }
-                    bullet->die();
-                }
+    // Bullets trace this tick's segment and resolve only their first contact
+    // among the base, terrain and enemy tanks (ties go in that order).
+    // Contacts, bullet-vs-bullet included, are found first against the world
+    // as it stands, on worker threads when there are many bullets. Damage,
+    // kills and sounds are then applied here in bullet order.
+    scheduleBulletLanes();
+    generateContacts(allTanks, bulletTankPairs, bulletPairs);
+    for (const ContactLane& lane : contactLanes_) {
+        for (const BulletContact& contact : lane.bulletContacts) {
+            // Resolving only removes obstacles, so a contact whose target is
+            // unchanged is still the first one; otherwise trace again.
+            if (isBulletContactCurrent(contact)) {
+                resolveBulletContact(contact);
+            } else if (const auto retraced = traceBullet(contact.bulletIndex, allTanks, bulletTankPairs, false)) {
+                resolveBulletContact(*retraced);
             }
         }
     }
-
-    // Bullet vs Bullet
-    collisionManager_.checkCollisionsInternal(bullets_);
+    for (const ContactLane& lane : contactLanes_) {
+        collisionManager_.resolveContacts(bullets_, lane.bulletPairs);
+    }
 
     // Spawn explosions for bullets/tanks destroyed during the collision phase.
     for (Bullet* bullet : bulletsAliveAtStart) {
         if (bullet && !bullet->isAlive()) {
             const Vector2 pos = centeredEffectTopLeft(bullet->getBounds(), static_cast<float>(Constants::ELEMENT_SIZE));
-            effects_.push_back(std::make_unique<BulletExplosion>(static_cast<int>(pos.x), static_cast<int>(pos.y)));
+            effects_.push_back(world_.create<BulletExplosion>(static_cast<int>(pos.x), static_cast<int>(pos.y)));
         }
     }
 
     for (ITank* tank : tanksAliveAtStart) {
         if (tank && !tank->isAlive()) {
             const Vector2 pos = centeredEffectTopLeft(tank->getBounds(), static_cast<float>(Constants::ELEMENT_SIZE * 2));
-            effects_.push_back(std::make_unique<TankExplosion>(static_cast<int>(pos.x), static_cast<int>(pos.y)));
-            playSfx(SoundId::Explosion);
+            effects_.push_back(world_.create<TankExplosion>(static_cast<int>(pos.x), static_cast<int>(pos.y)));
+            stateManager_.getContext().playSound(SoundId::Explosion);
         }
     }
 
-    if (player1_) {
+    // Bullets that flew off the map had their last segment traced above and
+    // leave quietly, without an explosion
+    world_.getBulletStore().retireOutOfBounds();
+
+    if (player1_ && playerNearPowerUp[0]) {
         if (const auto collected = powerUpManager_.tryCollect(*player1_)) {
             applyPowerUp(*player1_, *collected);
         }
     }
-    if (player2_) {
+    if (player2_ && playerNearPowerUp[1]) {
         if (const auto collected = powerUpManager_.tryCollect(*player2_)) {
             applyPowerUp(*player2_, *collected);
         }
     }
 }
 
+void PlayingState::generateContacts(const TankList& tanks, const IndexPairs& bulletTankPairs,
+                                    const IndexPairs& bulletPairs) {
+    const bool parallel = bullets_.size() >= parallelContactThreshold_;
+    if (parallel && !collisionWorkers_) {
+        collisionWorkers_ = std::make_unique<WorkerPool>(WorkerPool::defaultWorkerCount(MAX_COLLISION_WORKERS));
+    }
+
+    contactLanes_.resize(parallel ? collisionWorkers_->getLaneCount() : 1);
+    for (ContactLane& lane : contactLanes_) {
+        lane.bulletContacts.clear();
+        lane.bulletPairs.clear();
+    }
+
+    // Reads the world only; each lane writes to its own buffers
+    const auto generate = [&](size_t laneIndex, size_t begin, size_t end) {
+        ContactLane& lane = contactLanes_[laneIndex];
+        for (size_t i = begin; i < end; ++i) {
+            if (!bullets_[i]->isAlive()) continue;
+            if (const auto contact = traceBullet(i, tanks, bulletTankPairs, true)) {
+                lane.bulletContacts.push_back(*contact);
+            }
+        }
+
+        // Bullet vs Bullet, swept against each other's motion
+        auto pair = std::lower_bound(bulletPairs.begin(), bulletPairs.end(), std::make_pair(begin, size_t{0}));
+        for (; pair != bulletPairs.end() && pair->first < end; ++pair) {
+            const Bullet& a = *bullets_[pair->first];
+            const Bullet& b = *bullets_[pair->second];
+            if (CollisionManager::sweepAABB(a.getSegmentStartBounds(), a.getSegmentDelta() - b.getSegmentDelta(),
+                                            b.getSegmentStartBounds())) {
+                lane.bulletPairs.push_back(*pair);
+            }
+        }
+    };
+
+    if (parallel) {
+        // By reference: the Task wrapper then holds no copy of the closure
+        collisionWorkers_->parallelFor(bullets_.size(), std::ref(generate));
+    } else {
+        generate(0, 0, bullets_.size());
+    }
+}
+
+void PlayingState::scheduleBulletLanes() {
+    bulletLanes_.beginTick();
+    dueLanes_.assign(bullets_.size(), nullptr);
+
+    // Lanes are traced once per bullet, and again only once a change to
+    // static obstacles along them has marked them stale.
+    for (size_t i = 0; i < bullets_.size(); ++i) {
+        const Bullet& bullet = *bullets_[i];
+        if (!bullet.isAlive()) continue;
+        const BulletLaneSchedule::Lane* lane = bulletLanes_.touch(bullet.getId(), i);
+        const bool baseGone = lane && lane->target == BulletLaneSchedule::Target::Base && !(base_ && base_->isAlive());
+        if (!lane || lane->stale || baseGone ||
+            lane->direction != bullet.getDirection() || lane->speed != bullet.getSpeed()) {
+            traceBulletLane(i);
+        }
+    }
+    bulletLanes_.dropUnseen();
+
+    bulletLanes_.popDue([this](int bulletId, const BulletLaneSchedule::Lane& lane) {
+        const std::int64_t dueTick = getLaneDueTick(lane, *bullets_[lane.bulletIndex]);
+        if (dueTick > bulletLanes_.getTick()) {
+            bulletLanes_.reschedule(bulletId, dueTick);  // Queued early; not there yet
+        } else {
+            dueLanes_[lane.bulletIndex] = &lane;
+        }
+    });
+}
+
+void PlayingState::traceBulletLane(size_t bulletIndex) {
+    const Bullet& bullet = *bullets_[bulletIndex];
+    const Rectangle start = bullet.getSegmentStartBounds();
+    const Vector2 direction = directionToVector(bullet.getDirection());
+
+    BulletLaneSchedule::Lane lane;
+    lane.origin = start.position();
+    lane.direction = bullet.getDirection();
+    lane.speed = bullet.getSpeed();
+    lane.bulletIndex = bulletIndex;
+
+    // A power-of-two length keeps time * length an exact distance
+    float reach = BulletLaneSchedule::LANE_LENGTH;
+    if (const auto contact = traceStatic(start, direction * BulletLaneSchedule::LANE_LENGTH)) {
+        lane.target = contact->target == BulletContact::Target::Base
+            ? BulletLaneSchedule::Target::Base : BulletLaneSchedule::Target::Terrain;
+        lane.cell = contact->cell;
+        lane.impactDistance = contact->time * BulletLaneSchedule::LANE_LENGTH;
+        reach = lane.impactDistance + CONTACT_DEPTH;
+    }
+    lane.area = start.swept(direction * reach);
+
+    bulletLanes_.assign(bullet.getId(), lane, getLaneDueTick(lane, bullet));
+}
+
+std::int64_t PlayingState::getLaneDueTick(const BulletLaneSchedule::Lane& lane, const Bullet& bullet) const {
+    const Vector2 direction = directionToVector(lane.direction);
+    const Vector2 delta = bullet.getSegmentDelta();
+    const Vector2 travelled = bullet.getSegmentStartBounds().position() - lane.origin;
+    const float gap = lane.impactDistance - (travelled.x * direction.x + travelled.y * direction.y);
+    const float moved = delta.x * direction.x + delta.y * direction.y;
+
+    const std::int64_t now = bulletLanes_.getTick();
+    if (gap <= 0.0f || gap < moved) {
+        return now;
+    }
+    if (lane.speed <= 0.0f) {
+        return std::numeric_limits<std::int64_t>::max();
+    }
+    // Possibly a tick early (never late); the caller re-checks when it pops
+    const float ticks = std::floor((gap - moved) / lane.speed);
+    return now + std::max<std::int64_t>(1, static_cast<std::int64_t>(ticks));
+}
+
+std::optional<PlayingState::BulletContact> PlayingState::traceStatic(const Rectangle& box, const Vector2& delta) const {
+    std::optional<BulletContact> contact;
+
+    if (base_ && base_->isAlive()) {
+        if (const auto time = CollisionManager::sweepAABB(box, delta, base_->getBounds())) {
+            contact = BulletContact{0, BulletContact::Target::Base, {}, nullptr, *time};
+        }
+    }
+
+    float earliest = contact ? contact->time : 1.0f;
+    if (bulletBlockingBits_.any(box.swept(delta))) {
+        terrainMap_.sweep(box, delta, earliest, [&](TerrainCell cell, TerrainType type) {
+            if (!getTerrainMaterial(type).blocksBullets) {
+                return;
+            }
+            const auto time = CollisionManager::sweepAABB(box, delta, TerrainMap::getCellBounds(cell));
+            if (time && *time < earliest) {
+                earliest = *time;
+                contact = BulletContact{0, BulletContact::Target::Terrain, cell, nullptr, *time};
+            }
+        });
+    }
+    return contact;
+}
+
+std::optional<PlayingState::BulletContact> PlayingState::traceBullet(
+    size_t bulletIndex, const TankList& tanks, const IndexPairs& bulletTankPairs, bool useLanes) const {
+    const Bullet& bullet = *bullets_[bulletIndex];
+    const Rectangle start = bullet.getSegmentStartBounds();
+    const Vector2 delta = bullet.getSegmentDelta();
+    std::optional<BulletContact> contact;
+
+    if (!useLanes) {
+        contact = traceStatic(start, delta);
+    } else if (const BulletLaneSchedule::Lane* lane = dueLanes_[bulletIndex]) {
+        const Vector2 direction = directionToVector(lane->direction);
+        const Vector2 travelled = start.position() - lane->origin;
+        const float gap = lane->impactDistance - (travelled.x * direction.x + travelled.y * direction.y);
+        const float moved = delta.x * direction.x + delta.y * direction.y;
+        contact = BulletContact{0,
+                                lane->target == BulletLaneSchedule::Target::Base ? BulletContact::Target::Base
+                                                                                 : BulletContact::Target::Terrain,
+                                lane->cell, nullptr, gap <= 0.0f ? 0.0f : gap / moved};
+    }
+    if (contact) {
+        contact->bulletIndex = bulletIndex;
+    }
+    float earliest = contact ? contact->time : 1.0f;
+
+    // Bullets pass through their shooter and its teammates
+    const auto candidates = std::equal_range(
+        bulletTankPairs.begin(), bulletTankPairs.end(), std::make_pair(bulletIndex, size_t{0}),
+        [](const auto& l, const auto& r) { return l.first < r.first; });
+    for (auto candidate = candidates.first; candidate != candidates.second; ++candidate) {
+        Tank* tank = tanks[candidate->second];
+        if (!tank->isAlive()) continue;
+        if (bullet.getOwnerHandle() == tank->getHandle()) continue;
+        if ((bullet.getTeam() == Team::Player) == (tank->getTeam() == Team::Player)) continue;
+
+        const auto time = CollisionManager::sweepAABB(start, delta, tank->getBounds());
+        if (time && *time < earliest) {
+            earliest = *time;
+            contact = BulletContact{bulletIndex, BulletContact::Target::Tank, {}, tank, *time};
+        }
+    }
+
+    return contact;
+}
+
+bool PlayingState::isBulletContactCurrent(const BulletContact& contact) const {
+    switch (contact.target) {
+        case BulletContact::Target::Base:
+            return base_ && base_->isAlive();
+        case BulletContact::Target::Terrain:
+            // Cells are whole: if it still stands, it is still hit first
+            return getTerrainMaterial(terrainMap_.get(contact.cell)).blocksBullets;
+        case BulletContact::Target::Tank:
+            return contact.tank->isAlive();
+    }
+    return false;
+}
+
+void PlayingState::resolveBulletContact(const BulletContact& contact) {
+    Bullet& bullet = *bullets_[contact.bulletIndex];
+
+    // Stop the bullet at the contact point; the damage box reaches just
+    // past it so it overlaps what was hit.
+    bullet.setPosition(bullet.getSegmentStartBounds().position() + bullet.getSegmentDelta() * contact.time);
+    const Rectangle hitBox = bullet.getBounds().moved(directionToVector(bullet.getDirection()) * CONTACT_DEPTH);
+
+    switch (contact.target) {
+        case BulletContact::Target::Base:
+            base_->takeDamage(bullet.getAttack(), hitBox);
+            bullet.hit();
+            bullet.die();
+            if (!base_->isAlive()) {
+                bulletLanes_.invalidate(base_->getBounds());
+            }
+            break;
+
+        case BulletContact::Target::Terrain: {
+            if (terrainMap_.get(contact.cell) == TerrainType::Brick) {
+                stateManager_.getContext().playSound(SoundId::BrickBreak);
+            }
+            // Every cell under the damage box that this bullet can break goes
+            // at once, so later bullets this tick pass through the gap.
+            terrainMap_.anyOf(hitBox, [&](TerrainCell cell, TerrainType type) {
+                if (getTerrainMaterial(type).isBrokenBy(bullet.getLevel(), bullet.getAttack())) {
+                    setTerrainCell(cell.x, cell.y, TerrainType::Empty);
+                }
+                return false;
+            });
+            bullet.hit();
+            bullet.die();
+            break;
+        }
+
+        case BulletContact::Target::Tank: {
+            Tank* tank = contact.tank;
+            const bool targetIsPlayer = tank->getKind() == EntityKind::PlayerTank;
+            // Invincible players absorb the bullet without damage
+            if (!(targetIsPlayer && static_cast<PlayerTank*>(tank)->isInvincible())) {
+                // Apply damage using DamageCalculator
+                int damage = DamageCalculator::calculateDamage(
+                    bullet.getAttack(), tank->getDefense(), tank->getMaxHealth());
+                tank->takeDamage(damage);
+                stateManager_.getContext().playSound(
+                    targetIsPlayer ? SoundId::PlayerDamage : SoundId::TankHit);
+                if (!tank->isAlive() && tank->getKind() == EntityKind::EnemyTank) {
+                    registerEnemyDefeat(*static_cast<EnemyTank*>(tank), bullet.getOwnerHandle(), bullet.getHandle());
+                }
+            }
+            bullet.die();
+            break;
+        }
+    }
+}
+
 void PlayingState::removeDeadEntities() {
     // Remove dead bullets
     bullets_.erase(
@@ -531,46 +830,55 @@ void PlayingState::removeDeadEntities() {
         bullets_.end()
     );
 
-    // Remove dead enemies
-    std::unordered_map<const void*, int> killsByDamageSource;
+    // Remove dead enemies. Only a handful die per tick, so kills per damage
+    // source are counted in a flat list.
+    using SourceKills = std::pair<EntityHandle, int>;
+    FrameVector<SourceKills> killsByDamageSource{FrameAllocator<SourceKills>(frameArena_)};
+    const auto killsBy = [&killsByDamageSource](EntityHandle source) -> int& {
+        for (SourceKills& kills : killsByDamageSource) {
+            if (kills.first == source) {
+                return kills.second;
+            }
+        }
+        killsByDamageSource.emplace_back(source, 0);
+        return killsByDamageSource.back().second;
+    };
     for (const auto& enemy : enemies_) {
         if (enemy->isAlive()) {
             continue;
         }
-        const auto defeat = enemyDefeats_.find(enemy.get());
-        if (defeat != enemyDefeats_.end() && defeat->second.owner &&
-            defeat->second.damageSource && !defeat->second.preventsMultiplier) {
-            ++killsByDamageSource[defeat->second.damageSource];
+        const EnemyDefeat* defeat = findEnemyDefeat(*enemy);
+        if (defeat && resolvePlayerTank(world_, defeat->owner) &&
+            !defeat->damageSource.isNull() && !defeat->preventsMultiplier) {
+            ++killsBy(defeat->damageSource);
         }
     }
 
     int deadEnemies = 0;
     enemies_.erase(
         std::remove_if(enemies_.begin(), enemies_.end(),
-            [this, &deadEnemies, &killsByDamageSource](const std::unique_ptr<EnemyTank>& e) {
+            [this, &deadEnemies, &killsBy](const std::unique_ptr<EnemyTank>& e) {
                 if (!e->isAlive()) {
                     stateManager_.recordEnemyKill(e->getEnemyType());
-                    const auto defeat = enemyDefeats_.find(e.get());
-                    const bool wasBombed = defeat != enemyDefeats_.end() && defeat->second.preventsMultiplier;
+                    const EnemyDefeat* defeat = findEnemyDefeat(*e);
+                    const bool wasBombed = defeat && defeat->preventsMultiplier;
                     if (e->carriesPowerUp() && !wasBombed) {
                         powerUpManager_.spawn(e->getPosition(), chooseRandomPowerUp());
                     }
 
-                    if (defeat != enemyDefeats_.end() && defeat->second.owner) {
+                    if (PlayerTank* owner = defeat ? resolvePlayerTank(world_, defeat->owner) : nullptr) {
                         int multiplier = 1;
-                        if (!defeat->second.preventsMultiplier && defeat->second.damageSource) {
-                            multiplier = std::min(3, killsByDamageSource[defeat->second.damageSource]);
+                        if (!defeat->preventsMultiplier && !defeat->damageSource.isNull()) {
+                            multiplier = std::min(3, killsBy(defeat->damageSource));
                         }
                         const int points = e->getReward() * multiplier;
-                        defeat->second.owner->addScore(points);
-                        stateManager_.addPlayerScore(defeat->second.owner->getPlayerId(), points);
-                        effects_.push_back(std::make_unique<ScorePopup>(
+                        owner->addScore(points);
+                        stateManager_.addPlayerScore(owner->getPlayerId(), points);
+                        effects_.push_back(world_.create<ScorePopup>(
                             static_cast<int>(e->getPosition().x),
                             static_cast<int>(e->getPosition().y), e->getReward(), multiplier));
                     }
 
-                    enemyDefeats_.erase(e.get());
-                    detachBulletsFromTank(e.get());
                     ++deadEnemies;
                     return true;
                 }
@@ -578,15 +886,15 @@ void PlayingState::removeDeadEntities() {
             }),
         enemies_.end()
     );
+    // Removed enemies leave stale handles behind, in their defeats and as
+    // the owners of their bullets alike
+    enemyDefeats_.erase(
+        std::remove_if(enemyDefeats_.begin(), enemyDefeats_.end(),
+            [this](const EnemyDefeat& defeat) { return !world_.getHandles().isValid(defeat.enemy); }),
+        enemyDefeats_.end()
+    );
     enemiesAlive_ -= deadEnemies;
     enemiesAlive_ = std::max(0, enemiesAlive_);
-
-    // Remove destroyed terrain
-    terrains_.erase(
-        std::remove_if(terrains_.begin(), terrains_.end(),
-            [](const std::unique_ptr<ITerrain>& t) { return t->isDestroyed(); }),
-        terrains_.end()
-    );
 }
 
 void PlayingState::updateTimedPowerUps(float deltaTime) {
@@ -603,7 +911,7 @@ void PlayingState::updateTimedPowerUps(float deltaTime) {
 }
 
 void PlayingState::applyPowerUp(PlayerTank& player, PowerUpType type) {
-    playSfx(SoundId::GetBonus);
+    stateManager_.getContext().playSound(SoundId::GetBonus);
     switch (type) {
         case PowerUpType::Star:
             player.upgrade();
@@ -623,10 +931,10 @@ void PlayingState::applyPowerUp(PlayerTank& player, PowerUpType type) {
                     continue;
                 }
                 enemy->setCarriesPowerUp(false);
-                registerEnemyDefeat(*enemy, &player, nullptr, true);
+                registerEnemyDefeat(*enemy, player.getHandle(), EntityHandle(), true);
                 const Vector2 pos = centeredEffectTopLeft(
                     enemy->getBounds(), static_cast<float>(Constants::ELEMENT_SIZE * 2));
-                effects_.push_back(std::make_unique<TankExplosion>(static_cast<int>(pos.x), static_cast<int>(pos.y)));
+                effects_.push_back(world_.create<TankExplosion>(static_cast<int>(pos.x), static_cast<int>(pos.y)));
                 enemy->die();
             }
             break;
@@ -648,8 +956,6 @@ void PlayingState::fortifyBase() {
         return;
     }
 
-    syncDestructibleTerrainToMap();
-
     fortifiedCells_.clear();
     const Vector2 basePosition = level_->getBasePosition();
     const int baseX = static_cast<int>(basePosition.x) / Constants::CELL_SIZE;
@@ -666,17 +972,17 @@ void PlayingState::fortifyBase() {
         fortifiedCells_.push_back({baseX + 2, y});
     }
 
+    collectTankBoxes(tankBoxes_);
     for (const FortifiedCell& cell : fortifiedCells_) {
         // Never materialize a wall on top of a living tank - it would be
         // buried inside the obstacle with no way out.
         const Rectangle cellArea(cell.x * Constants::CELL_SIZE, cell.y * Constants::CELL_SIZE,
                                  Constants::CELL_SIZE, Constants::CELL_SIZE);
-        if (isAnyTankOverlapping(cellArea)) {
+        if (tankBoxes_.anyIntersects(cellArea)) {
             continue;
         }
-        level_->setTerrainAt(cell.x, cell.y, TerrainType::Steel);
+        setTerrainCell(cell.x, cell.y, TerrainType::Steel);
     }
-    createTerrain();
     baseFortifyTimer_ = Constants::POWERUP_BASE_FORTIFY_DURATION;
 }
 
@@ -685,78 +991,40 @@ void PlayingState::restoreFortifiedBase() {
         return;
     }
 
-    syncDestructibleTerrainToMap();
-
+    collectTankBoxes(tankBoxes_);
     for (const FortifiedCell& cell : fortifiedCells_) {
         // Match the original game's behaviour: after the shield expires the
         // perimeter is rebuilt as brick, even if a protected cell was hit.
         // Cells occupied by a living tank are skipped so nobody gets buried.
         const Rectangle cellArea(cell.x * Constants::CELL_SIZE, cell.y * Constants::CELL_SIZE,
                                  Constants::CELL_SIZE, Constants::CELL_SIZE);
-        if (isAnyTankOverlapping(cellArea)) {
+        if (tankBoxes_.anyIntersects(cellArea)) {
             continue;
         }
-        level_->setTerrainAt(cell.x, cell.y, TerrainType::Brick);
+        setTerrainCell(cell.x, cell.y, TerrainType::Brick);
     }
     fortifiedCells_.clear();
-    createTerrain();
 }
 
-void PlayingState::syncDestructibleTerrainToMap() {
-    if (!level_) {
-        return;
-    }
-
-    const int width = level_->getWidth();
-    const int height = level_->getHeight();
-
-    // Live destructible coverage derived from entities (the source of truth
-    // mid-game; destroyed entities are erased, so stale map marks must be
-    // cleared as well as live ones written back).
-    std::vector<std::vector<bool>> liveBrick(height, std::vector<bool>(width, false));
-    std::vector<std::vector<bool>> liveSteel(height, std::vector<bool>(width, false));
+PowerUpType PlayingState::chooseRandomPowerUp() {
+    return static_cast<PowerUpType>(random_.world().nextWeighted(Constants::POWERUP_DROP_WEIGHTS));
+}
 
-    for (const auto& terrain : terrains_) {
-        if (terrain->isDestroyed()) {
-            continue;
-        }
-        const Rectangle bounds = terrain->getBounds();
-        const int cellX = static_cast<int>(bounds.x) / Constants::CELL_SIZE;
-        const int cellY = static_cast<int>(bounds.y) / Constants::CELL_SIZE;
-        if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-            for (int i = 0; i < 4; ++i) {
-                if (brick->isCornerAlive(i)) {
-                    liveBrick[cellY + i / 2][cellX + i % 2] = true;
-                }
-            }
-        } else if (dynamic_cast<SteelWall*>(terrain.get())) {
-            liveSteel[cellY][cellX] = true;
-        }
+void PlayingState::registerEnemyDefeat(EnemyTank& enemy, EntityHandle owner,
+                                       EntityHandle damageSource, bool fromBomb) {
+    // The first defeat registered for an enemy stands
+    if (!findEnemyDefeat(enemy)) {
+        enemyDefeats_.push_back(EnemyDefeat{enemy.getHandle(), owner, damageSource, fromBomb});
     }
+}
 
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            const TerrainType type = level_->getTerrainAt(x, y);
-            if (type == TerrainType::Brick && !liveBrick[y][x]) {
-                level_->setTerrainAt(x, y, TerrainType::Empty);
-            } else if (type == TerrainType::Empty && liveBrick[y][x]) {
-                level_->setTerrainAt(x, y, TerrainType::Brick);
-            } else if (type == TerrainType::Steel && !liveSteel[y][x]) {
-                level_->setTerrainAt(x, y, TerrainType::Empty);
-            }
+const PlayingState::EnemyDefeat* PlayingState::findEnemyDefeat(const EnemyTank& enemy) const {
+    for (const EnemyDefeat& defeat : enemyDefeats_) {
+        if (defeat.enemy == enemy.getHandle()) {
+            return &defeat;
         }
     }
-}
-
-PowerUpType PlayingState::chooseRandomPowerUp() {
-    std::discrete_distribution<int> distribution(
-        std::begin(Constants::POWERUP_DROP_WEIGHTS), std::end(Constants::POWERUP_DROP_WEIGHTS));
-    return static_cast<PowerUpType>(distribution(powerUpRandom()));
-}
-
-void PlayingState::registerEnemyDefeat(EnemyTank& enemy, PlayerTank* owner,
-                                       const void* damageSource, bool fromBomb) {
-    enemyDefeats_.emplace(&enemy, EnemyDefeat{owner, damageSource, fromBomb});
+    return nullptr;
 }
 
 void PlayingState::checkGameState(float deltaTime) {
@@ -764,7 +1032,7 @@ void PlayingState::checkGameState(float deltaTime) {
     if (base_ && !base_->isAlive()) {
         gameOver_ = true;
         gameOverOverlay_.start();
-        playSfx(SoundId::GameOver);
+        stateManager_.getContext().playSound(SoundId::GameOver);
         return;
     }
 
@@ -775,7 +1043,7 @@ void PlayingState::checkGameState(float deltaTime) {
     if (player1Dead && player2Dead) {
         gameOver_ = true;
         gameOverOverlay_.start();
-        playSfx(SoundId::GameOver);
+        stateManager_.getContext().playSound(SoundId::GameOver);
         return;
     }
 
@@ -825,13 +1093,13 @@ void PlayingState::checkGameState(float deltaTime) {
 }
 
 void PlayingState::handleInput(const IInput& input) {
-    if (!levelFilePath_.empty() && input.isKeyPressed(SDL_SCANCODE_F6)) {
+    if (!levelFilePath_.empty() && input.isKeyPressed(Scancode::F6)) {
         stateManager_.popState();
         return;
     }
 
     // Toggle debug mode with F1 key
-    if (input.isKeyPressed(SDL_SCANCODE_F1)) {
+    if (input.isKeyPressed(Scancode::F1)) {
         debugMode_ = !debugMode_;
     }
 
@@ -845,7 +1113,7 @@ void PlayingState::handleInput(const IInput& input) {
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_ESCAPE)) {
+    if (input.isKeyPressed(Scancode::Escape)) {
         openPauseMenu();
         return;
     }
@@ -860,7 +1128,7 @@ void PlayingState::openPauseMenu() {
     paused_ = true;
     pauseOverlay_.setActive(true);
     pauseOverlay_.resetSelection();
-    playSfx(SoundId::Pause);
+    stateManager_.getContext().playSound(SoundId::Pause);
 }
 
 void PlayingState::resumeFromPause() {
@@ -879,27 +1147,27 @@ void PlayingState::restartLevel() {
 }
 
 void PlayingState::handlePauseMenuInput(const IInput& input) {
-    if (input.isKeyPressed(SDL_SCANCODE_ESCAPE)) {
+    if (input.isKeyPressed(Scancode::Escape)) {
         resumeFromPause();
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_UP) || input.isKeyPressed(SDL_SCANCODE_W)) {
+    if (input.isKeyPressed(Scancode::Up) || input.isKeyPressed(Scancode::W)) {
         pauseOverlay_.selectPreviousItem();
-    } else if (input.isKeyPressed(SDL_SCANCODE_DOWN) || input.isKeyPressed(SDL_SCANCODE_S)) {
+    } else if (input.isKeyPressed(Scancode::Down) || input.isKeyPressed(Scancode::S)) {
         pauseOverlay_.selectNextItem();
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_R)) {
+    if (input.isKeyPressed(Scancode::R)) {
         restartLevel();
         return;
     }
-    if (input.isKeyPressed(SDL_SCANCODE_M)) {
+    if (input.isKeyPressed(Scancode::M)) {
         stateManager_.changeToMenu();
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_RETURN) || input.isKeyPressed(SDL_SCANCODE_SPACE)) {
+    if (input.isKeyPressed(Scancode::Return) || input.isKeyPressed(Scancode::Space)) {
         switch (pauseOverlay_.getSelectedItem()) {
             case PauseOverlay::MenuItem::Continue:
                 resumeFromPause();
@@ -915,25 +1183,25 @@ void PlayingState::handlePauseMenuInput(const IInput& input) {
 }
 
 void PlayingState::handleGameOverMenuInput(const IInput& input) {
-    if (input.isKeyPressed(SDL_SCANCODE_ESCAPE) || input.isKeyPressed(SDL_SCANCODE_M)) {
+    if (input.isKeyPressed(Scancode::Escape) || input.isKeyPressed(Scancode::M)) {
         gameOverOverlay_.setSelectedItem(GameOverOverlay::MenuItem::MainMenu);
         stateManager_.changeToMenu();
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_UP) || input.isKeyPressed(SDL_SCANCODE_W)) {
+    if (input.isKeyPressed(Scancode::Up) || input.isKeyPressed(Scancode::W)) {
         gameOverOverlay_.selectPreviousItem();
-    } else if (input.isKeyPressed(SDL_SCANCODE_DOWN) || input.isKeyPressed(SDL_SCANCODE_S)) {
+    } else if (input.isKeyPressed(Scancode::Down) || input.isKeyPressed(Scancode::S)) {
         gameOverOverlay_.selectNextItem();
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_R)) {
+    if (input.isKeyPressed(Scancode::R)) {
         gameOverOverlay_.setSelectedItem(GameOverOverlay::MenuItem::Restart);
         restartLevel();
         return;
     }
 
-    if (input.isKeyPressed(SDL_SCANCODE_RETURN) || input.isKeyPressed(SDL_SCANCODE_SPACE)) {
+    if (input.isKeyPressed(Scancode::Return) || input.isKeyPressed(Scancode::Space)) {
         switch (gameOverOverlay_.getSelectedItem()) {
             case GameOverOverlay::MenuItem::Restart:
                 restartLevel();
@@ -963,6 +1231,12 @@ void PlayingState::handlePlayer2Input(const IInput& input) {
 }
 
 void PlayingState::render(IRenderer& renderer) {
+    renderInterpolated(renderer, 1.0f);
+}
+
+void PlayingState::renderInterpolated(IRenderer& renderer, float alpha) {
+    setRenderAlpha(alpha);
+
     // Clear with black
     renderer.clear(0, 0, 0, 255);
 
@@ -985,24 +1259,50 @@ void PlayingState::render(IRenderer& renderer) {
 }
 
 void PlayingState::renderTerrain(IRenderer& renderer) {
-    // Use ITerrain interface's getRenderLayer() instead of dynamic_cast
     // Render water first (under everything)
-    for (const auto& terrain : terrains_) {
-        if (terrain->getRenderLayer() == RenderLayer::Water && terrain->isActive()) {
-            terrain->render(renderer);
-        }
-    }
+    renderTerrainCells(renderer, RenderLayer::Water);
 
     // Render base
     if (base_) {
         base_->render(renderer);
     }
 
-    // Render walls (non-water, non-grass terrain)
-    for (const auto& terrain : terrains_) {
-        RenderLayer layer = terrain->getRenderLayer();
-        if (layer != RenderLayer::Water && layer != RenderLayer::Grass && terrain->isActive()) {
-            terrain->render(renderer);
+    // Render walls
+    renderTerrainCells(renderer, RenderLayer::Terrain);
+}
+
+void PlayingState::renderTerrainCells(IRenderer& renderer, RenderLayer layer) const {
+    constexpr int HALF_SIZE = Constants::CELL_SIZE;  // 17
+
+    for (int y = 0; y < terrainMap_.getHeight(); ++y) {
+        for (int x = 0; x < terrainMap_.getWidth(); ++x) {
+            const TerrainType type = terrainMap_.get(x, y);
+            if (type == TerrainType::Empty || getTerrainMaterial(type).layer != layer) {
+                continue;
+            }
+
+            // Each cell draws the top-left 17x17 of its material's tile
+            Rectangle source;
+            switch (type) {
+                case TerrainType::Brick:
+                    source = Rectangle(Sprites::Terrain::BRICK_X, Sprites::Terrain::BRICK_Y, HALF_SIZE, HALF_SIZE);
+                    break;
+                case TerrainType::Steel:
+                    source = Sprites::Terrain::getSteel();
+                    break;
+                case TerrainType::Water:
+                    source = Sprites::Terrain::getWater(waterFrame_);
+                    break;
+                case TerrainType::Grass:
+                    source = Sprites::Terrain::getGrass();
+                    break;
+                default:
+                    continue;
+            }
+
+            // Drawn at 18x18 so neighbouring cells overlap without gaps
+            renderer.drawSprite(static_cast<int>(source.x), static_cast<int>(source.y), HALF_SIZE, HALF_SIZE,
+                                x * HALF_SIZE, y * HALF_SIZE, HALF_SIZE + 1, HALF_SIZE + 1);
         }
     }
 }
@@ -1030,12 +1330,8 @@ void PlayingState::renderEntities(IRenderer& renderer) {
         }
     }
 
-    // Render grass last (on top of tanks) using ITerrain interface
-    for (const auto& terrain : terrains_) {
-        if (terrain->getRenderLayer() == RenderLayer::Grass && terrain->isActive()) {
-            terrain->render(renderer);
-        }
-    }
+    // Render grass last (on top of tanks)
+    renderTerrainCells(renderer, RenderLayer::Grass);
 
     powerUpManager_.render(renderer);
 
@@ -1100,34 +1396,18 @@ void PlayingState::renderDebugBounds(IRenderer& renderer) {
         }
     }
 
-    // Render terrain bounds
-    for (const auto& terrain : terrains_) {
-        if (!terrain->isActive() || terrain->isDestroyed()) continue;
-
-        const Constants::Color* color = nullptr;
-        const char* label = "";
-
-        if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-            color = &colorBrick;
-            label = "B";
-            // Render each corner for brick walls
-            for (int i = 0; i < 4; ++i) {
-                if (brick->isCornerAlive(i)) {
-                    Rectangle corner = brick->getCornerBounds(i);
-                    renderLabeledRect(corner, *color, "");
-                }
+    // Render terrain bounds, one per cell (brick cells unlabelled)
+    for (int y = 0; y < terrainMap_.getHeight(); ++y) {
+        for (int x = 0; x < terrainMap_.getWidth(); ++x) {
+            const TerrainType type = terrainMap_.get(x, y);
+            const Rectangle bounds = TerrainMap::getCellBounds({x, y});
+            if (type == TerrainType::Brick) {
+                renderLabeledRect(bounds, colorBrick, "");
+            } else if (type == TerrainType::Steel) {
+                renderLabeledRect(bounds, colorSteel, "S");
+            } else if (type == TerrainType::Water) {
+                renderLabeledRect(bounds, colorWater, "W");
             }
-            continue;
-        } else if (dynamic_cast<SteelWall*>(terrain.get())) {
-            color = &colorSteel;
-            label = "S";
-        } else if (dynamic_cast<Water*>(terrain.get())) {
-            color = &colorWater;
-            label = "W";
-        }
-
-        if (color) {
-            renderLabeledRect(terrain->getBounds(), *color, label);
         }
     }
 
@@ -1148,11 +1428,11 @@ void PlayingState::handleTankShooting(Tank& tank) {
     }
 
     Vector2 spawnPos = calculateBulletSpawnPosition(tank);
-    auto bullet = std::make_unique<Bullet>(spawnPos, tank.getDirection(), &tank, tank.getLevel());
+    auto bullet = world_.create<Bullet>(spawnPos, tank.getDirection(), &tank, tank.getLevel());
     addBullet(std::move(bullet));
 
-    if (dynamic_cast<PlayerTank*>(&tank)) {
-        playSfx(SoundId::BulletShot);
+    if (tank.getKind() == EntityKind::PlayerTank) {
+        stateManager_.getContext().playSound(SoundId::BulletShot);
     }
 }
 
@@ -1180,24 +1460,6 @@ Vector2 PlayingState::calculateBulletSpawnPosition(const Tank& tank) const {
     return Vector2(spawnX, spawnY);
 }
 
-void PlayingState::detachBulletsFromTank(ITank* tank) {
-    if (!tank) {
-        return;
-    }
-
-    for (auto& bullet : bullets_) {
-        if (bullet->getOwner() == tank) {
-            bullet->clearOwner();
-        }
-    }
-}
-
-void PlayingState::detachAllBulletOwners() {
-    for (auto& bullet : bullets_) {
-        bullet->clearOwner();
-    }
-}
-
 void PlayingState::addBullet(std::unique_ptr<Bullet> bullet) {
     bullets_.push_back(std::move(bullet));
 }
@@ -1212,10 +1474,11 @@ bool PlayingState::spawnEnemy() {
     const int spawnPointCount = static_cast<int>(spawnPoints.size());
     int chosenIndex = -1;
     Vector2 chosenPoint;
+    collectTankBoxes(tankBoxes_);
     for (int attempt = 0; attempt < spawnPointCount; ++attempt) {
         const int index = (currentSpawnPoint_ + attempt) % spawnPointCount;
         const Vector2& candidate = spawnPoints[index];
-        if (!isTankSpawnAreaFree(candidate)) {
+        if (!isTankSpawnAreaFree(candidate, tankBoxes_)) {
             continue;
         }
         chosenIndex = index;
@@ -1228,7 +1491,7 @@ bool PlayingState::spawnEnemy() {
     }
 
     const EnemySpawnInfo& info = spawnList[enemiesSpawned_];
-    auto enemy = std::make_unique<EnemyTank>(chosenPoint, info.type);
+    auto enemy = std::make_unique<EnemyTank>(world_, chosenPoint, info.type);
 
     configureEnemyAI(*enemy);
 
@@ -1254,12 +1517,12 @@ void PlayingState::configureEnemyAI(EnemyTank& enemy) {
     const Vector2 target = level_ ? level_->getBasePosition() : Vector2{};
     switch (enemy.getEnemyType()) {
         case EnemyType::Basic:
-            enemy.setAIBehavior(std::make_unique<SimpleAI>());
+            enemy.setAIBehavior(std::make_unique<SimpleAI>(random_.createStream()));
             break;
         case EnemyType::Fast: {
-            auto behavior = std::make_unique<PathfindingAI>();
+            auto behavior = std::make_unique<PathfindingAI>(random_.createStream());
             behavior->setTarget(target);
-            behavior->setLevel(level_.get());
+            behavior->setTerrain(&terrainMap_);
             enemy.setAIBehavior(std::move(behavior));
             break;
         }
@@ -1288,6 +1551,12 @@ void PlayingState::nextLevel() {
 }
 
 bool PlayingState::isTankSpawnAreaFree(const Vector2& position) const {
+    BoxBatch tanks;
+    collectTankBoxes(tanks);
+    return isTankSpawnAreaFree(position, tanks);
+}
+
+bool PlayingState::isTankSpawnAreaFree(const Vector2& position, const BoxBatch& tanks) const {
     // position is the top-left of the tank's actual collision box (see Tank::getBounds)
     constexpr float TANK_SIZE = static_cast<float>(Constants::TANK_COLLISION_SIZE);
     Rectangle spawnArea(position.x, position.y, TANK_SIZE, TANK_SIZE);
@@ -1296,53 +1565,30 @@ bool PlayingState::isTankSpawnAreaFree(const Vector2& position) const {
         return false;
     }
 
-    for (const auto& terrain : terrains_) {
-        if (!terrain->isActive()) continue;
-        if (terrain->isDestroyed()) continue;
-        if (terrain->isTankPassable()) continue;
-
-        if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-            if (brick->intersectsSolid(spawnArea)) {
-                return false;
-            }
-            continue;
-        }
-
-        if (CollisionManager::checkAABB(spawnArea, terrain->getBounds())) {
-            return false;
-        }
-    }
-
-    if (player1_ && player1_->isAlive() && CollisionManager::checkAABB(spawnArea, player1_->getBounds())) {
-        return false;
-    }
-    if (player2_ && player2_->isAlive() && CollisionManager::checkAABB(spawnArea, player2_->getBounds())) {
+    if (isTerrainBlockingTank(spawnArea)) {
         return false;
     }
 
-    for (const auto& enemy : enemies_) {
-        if (!enemy->isAlive()) continue;
-        if (CollisionManager::checkAABB(spawnArea, enemy->getBounds())) {
-            return false;
-        }
-    }
+    return !tanks.anyIntersects(spawnArea);
+}
 
-    return true;
+bool PlayingState::isTerrainBlockingTank(const Rectangle& area) const {
+    return !tankClearance_.isFree(area, tankBlockingBits_);
 }
 
-bool PlayingState::isAnyTankOverlapping(const Rectangle& area) const {
-    if (player1_ && player1_->isAlive() && CollisionManager::checkAABB(area, player1_->getBounds())) {
-        return true;
+void PlayingState::collectTankBoxes(BoxBatch& out) const {
+    out.clear();
+    if (player1_ && player1_->isAlive()) {
+        out.add(player1_->getBounds());
     }
-    if (player2_ && player2_->isAlive() && CollisionManager::checkAABB(area, player2_->getBounds())) {
-        return true;
+    if (player2_ && player2_->isAlive()) {
+        out.add(player2_->getBounds());
     }
     for (const auto& enemy : enemies_) {
-        if (enemy->isAlive() && CollisionManager::checkAABB(area, enemy->getBounds())) {
-            return true;
+        if (enemy->isAlive()) {
+            out.add(enemy->getBounds());
         }
     }
-    return false;
 }
 
 void PlayingState::clearSpawnAreaTerrain() {
@@ -1383,7 +1629,8 @@ void PlayingState::checkTankTerrainCollisions() {
     // during the spawn animation, so they must still collide with terrain -
     // otherwise they can drive into walls before the animation ends and get
     // stuck. (Bullets still ignore spawning tanks - spawn protection.)
-    std::vector<Tank*> allTanks;
+    TankList allTanks{FrameAllocator<Tank*>(frameArena_)};
+    allTanks.reserve(enemies_.size() + 2);
     if (player1_ && player1_->isAlive()) {
         allTanks.push_back(player1_.get());
     }
@@ -1423,21 +1670,7 @@ void PlayingState::checkTankTerrainCollisions() {
             }
 
             // Check against terrain
-            for (auto& terrain : terrains_) {
-                if (terrain->isTankPassable()) continue;
-                if (terrain->isDestroyed()) continue;
-
-                if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-                    if (!brick->intersectsSolid(tankBounds)) {
-                        continue;
-                    }
-                    return true;
-                }
-                if (CollisionManager::checkAABB(tankBounds, terrain->getBounds())) {
-                    return true;
-                }
-            }
-            return false;
+            return isTerrainBlockingTank(tankBounds);
         };
 
         // Check if the tank's previousPosition is already in collision
@@ -170,7 +170,7 @@ void ScoreState::renderRow(IRenderer& renderer, int row, int y) {
 
 void ScoreState::handleInput(const IInput& input) {
     if (animationComplete_) {
-        if (input.isKeyPressed(SDL_SCANCODE_RETURN) || input.isKeyPressed(SDL_SCANCODE_SPACE)) {
+        if (input.isKeyPressed(Scancode::Return) || input.isKeyPressed(Scancode::Space)) {
             if (victory_) {
                 // Go to next level (campaign loops back to stage 1 after the last)
                 int nextLevel = levelNumber_ + 1;
@@ -185,7 +185,7 @@ void ScoreState::handleInput(const IInput& input) {
         }
     } else {
         // Skip animation
-        if (input.isKeyPressed(SDL_SCANCODE_RETURN) || input.isKeyPressed(SDL_SCANCODE_SPACE)) {
+        if (input.isKeyPressed(Scancode::Return) || input.isKeyPressed(Scancode::Space)) {
             // Complete animation instantly
             for (int i = 0; i < 4; ++i) {
                 displayedKills_[i] = killCounts_[i];
@@ -246,7 +246,7 @@ void StageState::renderPlayerIndicators(IRenderer& renderer) {
 
 void StageState::handleInput(const IInput& input) {
     // Allow skipping with Enter or Space
-    if (input.isKeyPressed(SDL_SCANCODE_RETURN) || input.isKeyPressed(SDL_SCANCODE_SPACE)) {
+    if (input.isKeyPressed(Scancode::Return) || input.isKeyPressed(Scancode::Space)) {
         if (!readyToTransition_) {
             readyToTransition_ = true;
             stateManager_.changeToPlaying(levelNumber_, twoPlayerMode_, useWaveGenerator_);
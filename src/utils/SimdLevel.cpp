@@ -0,0 +1,46 @@
+#include "utils/SimdLevel.hpp"
+#include "utils/SimdIntrinsics.hpp"
+
+namespace tank {
+
+bool isSimdLevelSupported(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return true;
+        case SimdLevel::SSE2:
+#ifdef TANK_SIMD_SSE2
+            return true;
+#else
+            return false;
+#endif
+        case SimdLevel::AVX2:
+#ifdef TANK_SIMD_AVX2
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+SimdLevel detectSimdLevel() {
+    if (isSimdLevelSupported(SimdLevel::AVX2)) {
+        return SimdLevel::AVX2;
+    }
+    if (isSimdLevelSupported(SimdLevel::SSE2)) {
+        return SimdLevel::SSE2;
+    }
+    return SimdLevel::Scalar;
+}
+
+const char* getSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::SSE2: return "sse2";
+        case SimdLevel::AVX2: return "avx2";
+    }
+    return "unknown";
+}
+
+} // namespace tank
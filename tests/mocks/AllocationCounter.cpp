@@ -0,0 +1,52 @@
+#include "mocks/AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<bool> countAllocations{false};
+std::atomic<int> allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    if (countAllocations.load(std::memory_order_relaxed)) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+// The pairing with malloc above is deliberate
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+namespace tank {
+namespace test {
+
+AllocationCounter::AllocationCounter() {
+    allocationCount = 0;
+    countAllocations = true;
+}
+
+AllocationCounter::~AllocationCounter() {
+    countAllocations = false;
+}
+
+int AllocationCounter::count() const {
+    return allocationCount.load();
+}
+
+} // namespace test
+} // namespace tank
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace tank {
+namespace test {
+
+/**
+ * @brief Counts global operator new calls made while an instance is alive
+ *
+ * The test binary replaces the global operator new (AllocationCounter.cpp);
+ * outside a counting scope the replacement only forwards to malloc.
+ */
+class AllocationCounter {
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    int count() const;
+};
+
+} // namespace test
+} // namespace tank
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "audio/IAudioPlayer.hpp"
+#include <string>
+#include <vector>
+
+namespace tank {
+namespace test {
+
+/**
+ * @brief Audio player that records requests instead of touching a mixer
+ */
+class MockAudioPlayer : public IAudioPlayer {
+public:
+    bool initialize() override { return true; }
+    void shutdown() override {}
+
+    void playSound(SoundId id) override { sounds_.push_back(id); }
+    void stopSound(SoundId) override {}
+
+    void playMusic(const std::string& path, bool) override { music_.push_back(path); }
+    void stopMusic() override {}
+    void pauseMusic() override {}
+    void resumeMusic() override {}
+
+    void setMasterVolume(float volume) override { masterVolume_ = volume; }
+    void setSoundVolume(float) override {}
+    void setMusicVolume(float) override {}
+    float getMasterVolume() const override { return masterVolume_; }
+
+    const std::vector<SoundId>& getSounds() const { return sounds_; }
+    const std::vector<std::string>& getMusic() const { return music_; }
+
+private:
+    std::vector<SoundId> sounds_;
+    std::vector<std::string> music_;
+    float masterVolume_ = 1.0f;
+};
+
+} // namespace test
+} // namespace tank
@@ -17,9 +17,9 @@ public:
     void clear(uint8_t, uint8_t, uint8_t, uint8_t) override {}
     void present() override {}
 
-    ::SDL_Texture* loadTexture(const std::string&) override { return nullptr; }
-    void drawTexture(::SDL_Texture*, const Rectangle&) override {}
-    void drawTexture(::SDL_Texture*, const Rectangle&, const Rectangle&) override {}
+    TextureHandle loadTexture(const std::string&) override { return TextureHandle{}; }
+    void drawTexture(TextureHandle, const Rectangle&) override {}
+    void drawTexture(TextureHandle, const Rectangle&, const Rectangle&) override {}
 
     void drawSprite(int srcX, int srcY, int srcW, int srcH,
                     int destX, int destY, int destW, int destH) override {
@@ -35,13 +35,14 @@ public:
         previousKeycodes_ = currentKeycodes_;
     }
 
-    void setKeyDown(SDL_Scancode scancode, bool down) {
-        if (scancode < SDL_NUM_SCANCODES) {
-            currentKeys_[scancode] = down;
+    void setKeyDown(Scancode scancode, bool down) {
+        const int index = static_cast<int>(scancode);
+        if (index < SCANCODE_COUNT) {
+            currentKeys_[index] = down;
         }
     }
 
-    void setKeyDown(SDL_Keycode keycode, bool down) {
+    void setKeyDown(Keycode keycode, bool down) {
         if (down) {
             currentKeycodes_.insert(keycode);
         } else {
@@ -60,30 +61,32 @@ public:
         }
     }
 
-    bool isKeyDown(SDL_Keycode key) const override {
+    bool isKeyDown(Keycode key) const override {
         return currentKeycodes_.find(key) != currentKeycodes_.end();
     }
 
-    bool isKeyDown(SDL_Scancode scancode) const override {
-        if (scancode < SDL_NUM_SCANCODES) {
-            return currentKeys_[scancode];
+    bool isKeyDown(Scancode scancode) const override {
+        const int index = static_cast<int>(scancode);
+        if (index < SCANCODE_COUNT) {
+            return currentKeys_[index];
         }
         return false;
     }
 
-    bool isKeyPressed(SDL_Keycode key) const override {
+    bool isKeyPressed(Keycode key) const override {
         return currentKeycodes_.find(key) != currentKeycodes_.end() &&
                previousKeycodes_.find(key) == previousKeycodes_.end();
     }
 
-    bool isKeyPressed(SDL_Scancode scancode) const override {
-        if (scancode < SDL_NUM_SCANCODES) {
-            return currentKeys_[scancode] && !previousKeys_[scancode];
+    bool isKeyPressed(Scancode scancode) const override {
+        const int index = static_cast<int>(scancode);
+        if (index < SCANCODE_COUNT) {
+            return currentKeys_[index] && !previousKeys_[index];
         }
         return false;
     }
 
-    bool isKeyReleased(SDL_Keycode key) const override {
+    bool isKeyReleased(Keycode key) const override {
         return currentKeycodes_.find(key) == currentKeycodes_.end() &&
                previousKeycodes_.find(key) != previousKeycodes_.end();
     }
@@ -115,10 +118,10 @@ public:
 private:
     static constexpr int MOUSE_BUTTON_COUNT = 8;
 
-    std::array<bool, SDL_NUM_SCANCODES> currentKeys_{};
-    std::array<bool, SDL_NUM_SCANCODES> previousKeys_{};
-    std::unordered_set<SDL_Keycode> currentKeycodes_{};
-    std::unordered_set<SDL_Keycode> previousKeycodes_{};
+    std::array<bool, SCANCODE_COUNT> currentKeys_{};
+    std::array<bool, SCANCODE_COUNT> previousKeys_{};
+    std::unordered_set<Keycode> currentKeycodes_{};
+    std::unordered_set<Keycode> previousKeycodes_{};
     std::array<bool, MOUSE_BUTTON_COUNT> currentMouseButtons_{};
     std::array<bool, MOUSE_BUTTON_COUNT> previousMouseButtons_{};
     int mouseX_ = 0;
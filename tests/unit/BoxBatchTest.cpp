@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "collision/BoxBatch.hpp"
+#include "collision/OccupancyBitmap.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+// Restores the detected kernel when a test forces another one
+class KernelGuard {
+public:
+    KernelGuard() : saved_(BoxBatch::getKernel()) {}
+    ~KernelGuard() { BoxBatch::setKernel(saved_); }
+
+private:
+    BoxKernel saved_;
+};
+
+Rectangle randomBox(RandomStream& random) {
+    return Rectangle(random.nextFloat() * 400.0f, random.nextFloat() * 400.0f,
+                     random.nextFloat() * 40.0f, random.nextFloat() * 40.0f);
+}
+
+} // namespace
+
+TEST(BoxBatchTest, EveryKernelMatchesRectangleIntersects) {
+    KernelGuard guard;
+    RandomStream random(19);
+
+    // 150 boxes: two full 64-box blocks and a partial one
+    std::vector<Rectangle> boxes;
+    BoxBatch batch;
+    for (int i = 0; i < 150; ++i) {
+        boxes.push_back(randomBox(random));
+        batch.add(boxes.back());
+    }
+    // Touching edges do not overlap
+    boxes.emplace_back(100.0f, 100.0f, 20.0f, 20.0f);
+    batch.add(boxes.back());
+
+    std::vector<Rectangle> queries{Rectangle(120.0f, 100.0f, 10.0f, 10.0f), Rectangle(90.0f, 80.0f, 10.0f, 20.0f)};
+    for (int i = 0; i < 200; ++i) {
+        queries.push_back(randomBox(random));
+    }
+
+    for (BoxKernel kernel : {BoxKernel::Scalar, BoxKernel::SSE2, BoxKernel::AVX2}) {
+        if (!BoxBatch::setKernel(kernel)) {
+            continue;
+        }
+        std::vector<std::uint64_t> mask;
+        for (const Rectangle& query : queries) {
+            batch.intersectMask(query, mask);
+            ASSERT_EQ(mask.size(), 3u);
+            bool any = false;
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                const bool expected = boxes[i].intersects(query);
+                any = any || expected;
+                ASSERT_EQ(((mask[i / 64] >> (i % 64)) & 1) != 0, expected)
+                    << BoxBatch::getKernelName(kernel) << " box " << i;
+            }
+            EXPECT_EQ(batch.anyIntersects(query), any) << BoxBatch::getKernelName(kernel);
+        }
+    }
+}
+
+TEST(BoxBatchTest, ForEachIntersectingVisitsOnlyTheRangeInOrder) {
+    KernelGuard guard;
+    BoxBatch batch;
+    for (int i = 0; i < 100; ++i) {
+        batch.add(Rectangle(static_cast<float>(i), 0.0f, 10.0f, 10.0f));
+    }
+
+    for (BoxKernel kernel : {BoxKernel::Scalar, BoxKernel::SSE2, BoxKernel::AVX2}) {
+        if (!BoxBatch::setKernel(kernel)) {
+            continue;
+        }
+        // Boxes 41..50 overlap [50, 51); the range cuts that to 45..50
+        std::vector<size_t> visited;
+        batch.forEachIntersecting(Rectangle(50.0f, 0.0f, 1.0f, 1.0f), 45, 55,
+                                  [&](size_t index) { visited.push_back(index); });
+        std::vector<size_t> expected;
+        for (size_t i = 45; i <= 50; ++i) {
+            expected.push_back(i);
+        }
+        EXPECT_EQ(visited, expected) << BoxBatch::getKernelName(kernel);
+    }
+}
+
+TEST(BoxBatchTest, SwitchingKernelsDuringASweepKeepsResults) {
+    KernelGuard guard;
+    RandomStream random(23);
+    BoxBatch batch;
+    for (int i = 0; i < 150; ++i) {
+        batch.add(randomBox(random));
+    }
+    const Rectangle query(150.0f, 150.0f, 100.0f, 100.0f);
+    std::vector<std::uint64_t> expected;
+    batch.intersectMask(query, expected);
+
+    // A contact worker sweeps while the main thread flips kernels
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::thread sweeper([&] {
+        std::vector<std::uint64_t> mask;
+        while (!done.load()) {
+            batch.intersectMask(query, mask);
+            if (mask != expected) {
+                ++mismatches;
+            }
+        }
+    });
+    for (int i = 0; i < 2000; ++i) {
+        BoxBatch::setKernel(i % 2 ? BoxKernel::Scalar : detectSimdLevel());
+    }
+    done = true;
+    sweeper.join();
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST(BoxBatchTest, EmptyBatchAndClearedBatchHitNothing) {
+    BoxBatch batch;
+    EXPECT_FALSE(batch.anyIntersects(Rectangle(0.0f, 0.0f, 1000.0f, 1000.0f)));
+
+    batch.add(Rectangle(10.0f, 10.0f, 5.0f, 5.0f));
+    ASSERT_TRUE(batch.anyIntersects(Rectangle(0.0f, 0.0f, 1000.0f, 1000.0f)));
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_FALSE(batch.anyIntersects(Rectangle(0.0f, 0.0f, 1000.0f, 1000.0f)));
+}
+
+TEST(BoxBatchTest, SpawnPointUnderATankIsNotFree) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+
+    const Vector2 spawn(200.0f, 200.0f);
+    state.player1_->setPosition(Vector2(-100.0f, -100.0f));
+    EXPECT_TRUE(state.isTankSpawnAreaFree(spawn));
+
+    state.player1_->setPosition(Vector2(215.0f, 220.0f));
+    EXPECT_FALSE(state.isTankSpawnAreaFree(spawn));
+
+    BoxBatch tanks;
+    state.collectTankBoxes(tanks);
+    ASSERT_EQ(tanks.size(), 1u);
+    EXPECT_FALSE(state.isTankSpawnAreaFree(spawn, tanks));
+    EXPECT_TRUE(state.isTankSpawnAreaFree(Vector2(300.0f, 200.0f), tanks));
+}
+
+TEST(BoxBatchTest, KernelFamiliesShareOneCpuDetection) {
+    const SimdLevel detected = detectSimdLevel();
+    EXPECT_TRUE(isSimdLevelSupported(detected));
+    EXPECT_TRUE(isSimdLevelSupported(SimdLevel::Scalar));
+    EXPECT_STREQ(BoxBatch::getKernelName(detected), OccupancyBitmap::getKernelName(detected));
+
+    // A level the CPU lacks is refused by both families alike
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+        KernelGuard guard;
+        const OccupancyKernel saved = OccupancyBitmap::getKernel();
+        EXPECT_EQ(BoxBatch::setKernel(level), isSimdLevelSupported(level));
+        EXPECT_EQ(OccupancyBitmap::setKernel(level), isSimdLevelSupported(level));
+        OccupancyBitmap::setKernel(saved);
+    }
+}
+
+} // namespace tank::test
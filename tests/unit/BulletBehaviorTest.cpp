@@ -24,7 +24,7 @@ TEST_F(BulletBehaviorTest, PlayerFireShouldCreateBulletInPlayingState) {
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
 
     state.level_ = std::make_unique<Level>(1);
-    state.player1_ = std::make_unique<PlayerTank>(1, Vector2(0.0f, 0.0f));
+    state.player1_ = std::make_unique<PlayerTank>(state.world_, 1, Vector2(0.0f, 0.0f));
     state.bullets_.clear();
 
     ASSERT_TRUE(state.bullets_.empty()) << "test precondition";
@@ -32,7 +32,7 @@ TEST_F(BulletBehaviorTest, PlayerFireShouldCreateBulletInPlayingState) {
     state.player1_->update(1.0f);  // finish spawn animation
 
     ScriptedInput input;
-    input.setKeyDown(SDL_SCANCODE_SPACE, true);
+    input.setKeyDown(Scancode::Space, true);
     state.handleInput(input);
     state.updateEntities(kDelta);
 
@@ -44,16 +44,17 @@ TEST_F(BulletBehaviorTest, BulletsClearOwnerWhenTankDetached) {
     GameStateManager manager;
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
     state.level_ = std::make_unique<Level>(1);
-    state.player1_ = std::make_unique<PlayerTank>(1, Vector2(0.0f, 0.0f));
+    state.player1_ = std::make_unique<PlayerTank>(state.world_, 1, Vector2(0.0f, 0.0f));
 
-    auto bullet = std::make_unique<Bullet>(Vector2(0.0f, 0.0f), Direction::Up, state.player1_.get(), 0);
+    auto bullet = std::make_unique<Bullet>(state.world_, Vector2(0.0f, 0.0f), Direction::Up, state.player1_.get(), 0);
     Bullet* bulletPtr = bullet.get();
     state.bullets_.push_back(std::move(bullet));
 
-    state.detachBulletsFromTank(state.player1_.get());
+    ASSERT_EQ(state.player1_.get(), bulletPtr->getOwner());
+    state.player1_.reset();
 
     EXPECT_EQ(nullptr, bulletPtr->getOwner())
-        << "Bullet owner pointer must be cleared once tank is removed from the state";
+        << "Bullet owner must resolve to null once tank is removed from the state";
 }
 
 }  // namespace test
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "collision/BulletLaneSchedule.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+#include <memory>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+void clearArena(PlayingState& state) {
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->setPosition(Vector2(400.0f, 400.0f));
+}
+
+Bullet* fireBullet(PlayingState& state, const Vector2& position, Direction direction, float speed) {
+    auto bullet = std::make_unique<Bullet>(state.world_, position, direction, nullptr);
+    bullet->setSpeed(speed);
+    Bullet* raw = bullet.get();
+    state.bullets_.push_back(std::move(bullet));
+    return raw;
+}
+
+void tick(PlayingState& state) {
+    for (auto& bullet : state.bullets_) {
+        if (bullet->isAlive()) {
+            bullet->update(Constants::FIXED_DELTA_TIME);
+        }
+    }
+    state.checkCollisions();
+}
+
+} // namespace
+
+TEST(BulletLaneScheduleTest, LaneIsTracedOnceAndFallsDueOnTheImpactTick) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    clearArena(state);
+
+    state.setTerrainCell(20, 6, TerrainType::Steel);
+    // Gap to the wall: 340 - 108 = 232 px, 6 px per tick: contact in tick 39
+    Bullet* bullet = fireBullet(state, Vector2(100.0f, 6 * kCell + 4.0f), Direction::Right, 6.0f);
+
+    tick(state);
+    const auto* lane = state.bulletLanes_.touch(bullet->getId(), 0);
+    ASSERT_NE(lane, nullptr);
+    EXPECT_EQ(lane->target, BulletLaneSchedule::Target::Terrain);
+    EXPECT_FLOAT_EQ(lane->impactDistance, 232.0f);
+    const auto version = lane->version;
+
+    for (int i = 2; i < 39; ++i) {
+        tick(state);
+        ASSERT_TRUE(bullet->isAlive()) << "tick " << i;
+    }
+    EXPECT_EQ(state.bulletLanes_.touch(bullet->getId(), 0)->version, version) << "never traced again";
+
+    tick(state);
+    EXPECT_FALSE(bullet->isAlive());
+    EXPECT_FLOAT_EQ(bullet->getPosition().x, 20 * kCell - 8.0f);
+}
+
+TEST(BulletLaneScheduleTest, TerrainAddedIntoALaneIsHit) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    clearArena(state);
+
+    Bullet* bullet = fireBullet(state, Vector2(6 * kCell + 4.0f, 400.0f), Direction::Up, 10.0f);
+    tick(state);
+    EXPECT_EQ(state.bulletLanes_.touch(bullet->getId(), 0)->target, BulletLaneSchedule::Target::None);
+    EXPECT_EQ(state.bulletLanes_.getQueuedCount(), 0u) << "open lanes are never queued";
+
+    state.setTerrainCell(6, 10, TerrainType::Steel);
+    for (int i = 0; i < 30 && bullet->isAlive(); ++i) {
+        tick(state);
+    }
+    EXPECT_FALSE(bullet->isAlive());
+    EXPECT_FLOAT_EQ(bullet->getPosition().y, 11 * kCell);
+}
+
+TEST(BulletLaneScheduleTest, LanesMatchPerTickTracing) {
+    GameStateManager manager;
+    PlayingState lanes(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    PlayingState traced(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    lanes.enter();
+    traced.enter();
+
+    // Level 1 terrain and base; several bullets share lanes through bricks
+    for (PlayingState* state : {&lanes, &traced}) {
+        state->bullets_.clear();
+        state->enemies_.clear();
+        state->player1_->setPosition(Vector2(-100.0f, -100.0f));
+        RandomStream random(41);
+        for (int i = 0; i < 120; ++i) {
+            const float x = static_cast<float>(random.nextInt(0, 26)) * kCell + 4.0f;
+            const float y = static_cast<float>(random.nextInt(0, 26)) * kCell + 4.0f;
+            const Direction direction = static_cast<Direction>(random.nextInt(0, 3));
+            fireBullet(*state, Vector2(x, y), direction, static_cast<float>(random.nextInt(2, 12)));
+        }
+    }
+
+    for (int i = 0; i < 80; ++i) {
+        traced.bulletLanes_.invalidateAll();  // Re-trace every lane every tick
+        tick(traced);
+        tick(lanes);
+    }
+
+    for (size_t i = 0; i < lanes.bullets_.size(); ++i) {
+        EXPECT_EQ(lanes.bullets_[i]->isAlive(), traced.bullets_[i]->isAlive()) << "bullet " << i;
+        EXPECT_EQ(lanes.bullets_[i]->getPosition(), traced.bullets_[i]->getPosition()) << "bullet " << i;
+    }
+    EXPECT_EQ(lanes.terrainMap_.getCells(), traced.terrainMap_.getCells());
+    EXPECT_EQ(lanes.base_->isAlive(), traced.base_->isAlive());
+}
+
+} // namespace tank::test
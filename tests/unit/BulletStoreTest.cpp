@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "entities/projectiles/BulletStore.hpp"
+#include "mocks/AllocationCounter.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace tank::test {
+
+TEST(BulletStoreTest, BulletsTakeASlotInTheirWorldsStore) {
+    EntityWorld world;
+    EntityWorld other;
+    BulletStore& store = world.getBulletStore();
+    auto bullet = std::make_unique<Bullet>(world, Vector2(100.0f, 120.0f), Direction::Left, nullptr, 1);
+    EXPECT_EQ(bullet->store_, &store);
+    EXPECT_EQ(store.getBulletCount(), 1u);
+    EXPECT_EQ(other.getBulletStore().getBulletCount(), 0u);
+    EXPECT_FLOAT_EQ(bullet->getSpeed(), Constants::BULLET_DEFAULT_SPEED * 2);
+
+    bullet.reset();
+    EXPECT_EQ(store.getBulletCount(), 0u);
+    // The freed slot is reused
+    auto next = std::make_unique<Bullet>(world, Vector2(10.0f, 10.0f), Direction::Up, nullptr);
+    EXPECT_EQ(next->slot_, 0u);
+    EXPECT_EQ(store.positions_.size(), 1u);
+}
+
+TEST(BulletStoreTest, EntityViewOfABulletReadsItsStoredPosition) {
+    EntityWorld world;
+    Bullet bullet(world, Vector2(100.0f, 120.0f), Direction::Left, nullptr);
+    Entity& entity = bullet;
+    entity.snapshotTransform();
+    bullet.update(Constants::FIXED_DELTA_TIME);
+
+    EXPECT_EQ(entity.getPosition(), bullet.getPosition());
+    EXPECT_EQ(entity.getBounds().position(), bullet.getPosition());
+    entity.setRenderAlpha(0.0f);
+    EXPECT_EQ(entity.getRenderPosition(), Vector2(100.0f, 120.0f));
+    entity.setRenderAlpha(1.0f);
+    EXPECT_EQ(entity.getRenderPosition(), bullet.getPosition());
+}
+
+TEST(BulletStoreTest, ABulletDoesNotAllocateItsOwnStore) {
+    EntityWorld world;
+    // Warm the world's store and the bullet pool
+    world.create<Bullet>(Vector2(), Direction::Up, nullptr).reset();
+
+    AllocationCounter allocations;
+    auto bullet = world.create<Bullet>(Vector2(10.0f, 10.0f), Direction::Up, nullptr);
+    EXPECT_EQ(bullet->store_, &world.getBulletStore());
+    bullet.reset();
+    EXPECT_EQ(allocations.count(), 0) << "no store per bullet";
+}
+
+TEST(BulletStoreTest, AdvanceMatchesPerBulletUpdate) {
+    // Separate worlds, so advance() only moves the stored half
+    EntityWorld batched;
+    EntityWorld perObject;
+    BulletStore& store = batched.getBulletStore();
+    std::vector<std::unique_ptr<Bullet>> stored;
+    std::vector<std::unique_ptr<Bullet>> single;
+    RandomStream random(5);
+    for (int i = 0; i < 200; ++i) {
+        const Vector2 position(random.nextFloat() * Constants::GAME_WIDTH, random.nextFloat() * Constants::GAME_HEIGHT);
+        const auto direction = static_cast<Direction>(random.nextInt(0, 3));
+        const int level = random.nextInt(0, 3);
+        stored.push_back(std::make_unique<Bullet>(batched, position, direction, nullptr, level));
+        single.push_back(std::make_unique<Bullet>(perObject, position, direction, nullptr, level));
+        if (i % 7 == 0) {
+            stored.back()->hit();
+            single.back()->hit();
+        }
+    }
+
+    for (int tick = 0; tick < 30; ++tick) {
+        store.advance();
+        store.retireOutOfBounds();
+        for (auto& bullet : single) {
+            if (bullet->isAlive()) {
+                bullet->update(Constants::FIXED_DELTA_TIME);
+            }
+        }
+    }
+
+    int alive = 0;
+    for (size_t i = 0; i < stored.size(); ++i) {
+        ASSERT_EQ(stored[i]->isAlive(), single[i]->isAlive()) << "bullet " << i;
+        ASSERT_EQ(stored[i]->isActive(), single[i]->isActive()) << "bullet " << i;
+        ASSERT_EQ(stored[i]->getPosition(), single[i]->getPosition()) << "bullet " << i;
+        ASSERT_EQ(stored[i]->getSegmentDelta(), single[i]->getSegmentDelta()) << "bullet " << i;
+        alive += stored[i]->isAlive() ? 1 : 0;
+    }
+    EXPECT_GT(alive, 0);
+    EXPECT_LT(alive, 200);
+}
+
+TEST(BulletStoreTest, PlayingStateAdvancesBulletsThroughItsStore) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(2.0f, 200.0f), Direction::Left, nullptr));
+    state.updateEntities(Constants::FIXED_DELTA_TIME);
+    EXPECT_EQ(state.world_.getBulletStore().getBulletCount(), 1u);
+    EXPECT_EQ(state.bullets_[0]->store_, &state.world_.getBulletStore());
+    EXPECT_TRUE(state.bullets_[0]->isAlive()) << "left the map, but not yet traced";
+    state.checkCollisions();
+    EXPECT_FALSE(state.bullets_[0]->isAlive()) << "left the map";
+
+    state.removeDeadEntities();
+    EXPECT_EQ(state.world_.getBulletStore().getBulletCount(), 0u);
+}
+
+} // namespace tank::test
@@ -15,7 +15,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -34,7 +34,7 @@ TEST(CampaignFirstLevelFlowTest, Press1FromMenuStartsStage1ThenPlayingLevel1With
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Menu);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_1);
+    pressKeyOnce(manager, input, Scancode::Num1);
     manager.update(0.0f);  // Apply pending change -> StageState
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -67,7 +67,7 @@ TEST(CampaignFirstLevelFlowTest, VictoryFromLevel1TransitionsToStage2ThenPlaying
     manager.update(0.0f);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_1);
+    pressKeyOnce(manager, input, Scancode::Num1);
     manager.update(0.0f);  // -> StageState(1)
 
     // StageState(1) -> PlayingState(1)
@@ -99,8 +99,8 @@ TEST(CampaignFirstLevelFlowTest, VictoryFromLevel1TransitionsToStage2ThenPlaying
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Score);
 
     // Skip tally animation, then continue -> StageState(2).
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(manager, input, Scancode::Return);
+    pressKeyOnce(manager, input, Scancode::Return);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
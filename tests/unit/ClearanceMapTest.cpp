@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "collision/ClearanceMap.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+Rectangle randomBlock(RandomStream& random) {
+    return Rectangle(static_cast<float>(random.nextInt(0, 190)), static_cast<float>(random.nextInt(0, 190)),
+                     static_cast<float>(random.nextInt(1, 17)), static_cast<float>(random.nextInt(1, 17)));
+}
+
+} // namespace
+
+TEST(ClearanceMapTest, ValuesAreTheLargestFreeSquare) {
+    OccupancyBitmap bits(100, 100);
+    bits.fill(Rectangle(50.0f, 50.0f, 1.0f, 1.0f));
+    ClearanceMap clearance;
+    clearance.rebuild(bits);
+
+    EXPECT_EQ(clearance.getClearance(50, 50), 0);
+    EXPECT_EQ(clearance.getClearance(49, 49), 1);
+    EXPECT_EQ(clearance.getClearance(40, 45), 10);
+    // Capped, and open space past the map edge counts as free
+    EXPECT_EQ(clearance.getClearance(0, 0), ClearanceMap::MAX_CLEARANCE);
+    EXPECT_EQ(clearance.getClearance(99, 99), ClearanceMap::MAX_CLEARANCE);
+}
+
+TEST(ClearanceMapTest, IncrementalUpdatesMatchARebuildAndTheBitmap) {
+    RandomStream random(5);
+    OccupancyBitmap bits(200, 200);
+    ClearanceMap incremental;
+    incremental.rebuild(bits);
+
+    for (int step = 0; step < 60; ++step) {
+        const Rectangle block = randomBlock(random);
+        if (random.nextInt(0, 2) == 0) {
+            bits.erase(block);
+        } else {
+            bits.fill(block);
+        }
+        incremental.update(bits, block);
+    }
+
+    ClearanceMap rebuilt;
+    rebuilt.rebuild(bits);
+    for (int y = 0; y < 200; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            ASSERT_EQ(incremental.getClearance(x, y), rebuilt.getClearance(x, y)) << x << "," << y;
+        }
+    }
+
+    // Tank boxes at whole and fractional positions, some past the edges
+    for (int i = 0; i < 2000; ++i) {
+        const Rectangle box(-10.0f + random.nextFloat() * 210.0f, -10.0f + random.nextFloat() * 210.0f,
+                            static_cast<float>(Constants::TANK_COLLISION_SIZE),
+                            static_cast<float>(Constants::TANK_COLLISION_SIZE));
+        ASSERT_EQ(incremental.isFree(box, bits), !bits.any(box)) << box.x << "," << box.y;
+    }
+    // Non-square boxes take the bitmap fallback when needed
+    for (int i = 0; i < 500; ++i) {
+        const Rectangle box(random.nextFloat() * 200.0f, random.nextFloat() * 200.0f,
+                            1.0f + random.nextFloat() * 60.0f, 1.0f + random.nextFloat() * 8.0f);
+        ASSERT_EQ(incremental.isFree(box, bits), !bits.any(box));
+    }
+}
+
+TEST(ClearanceMapTest, SpawnAreaFreesUpWhenABrickIsShotAway) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->setPosition(Vector2(400.0f, 400.0f));
+
+    const Vector2 spawn(10 * kCell, 2 * kCell);
+    state.setTerrainCell(10, 3, TerrainType::Brick);
+    ASSERT_FALSE(state.isTankSpawnAreaFree(spawn));
+
+    auto bullet = std::make_unique<Bullet>(state.world_, Vector2(10 * kCell + 4.0f, 4 * kCell + 4.0f), Direction::Up, nullptr);
+    bullet->setSpeed(10.0f);
+    bullet->update(Constants::FIXED_DELTA_TIME);
+    state.bullets_.push_back(std::move(bullet));
+    state.checkCollisions();
+
+    EXPECT_TRUE(state.isTankSpawnAreaFree(spawn));
+    EXPECT_EQ(state.tankClearance_.getClearance(static_cast<int>(spawn.x), static_cast<int>(spawn.y)),
+              ClearanceMap::MAX_CLEARANCE);
+}
+
+} // namespace tank::test
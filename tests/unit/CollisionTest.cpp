@@ -7,7 +7,6 @@
 #include "collision/CollisionManager.hpp"
 #include "collision/handlers/BulletBulletHandler.hpp"
 #include "collision/handlers/TankTankHandler.hpp"
-#include "collision/handlers/TankTerrainHandler.hpp"
 #include "utils/Rectangle.hpp"
 
 namespace tank {
@@ -7,7 +7,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -26,14 +26,14 @@ TEST(ConstructionStateExitConfirmTest, DirtyLevelRequiresSecondEscapeToReturnToM
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Construction);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_N);  // New level -> dirty.
+    pressKeyOnce(manager, input, Scancode::N);  // New level -> dirty.
 
-    pressKeyOnce(manager, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(manager, input, Scancode::Escape);
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
     EXPECT_EQ(manager.getCurrentState()->getType(), StateType::Construction);
 
-    pressKeyOnce(manager, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(manager, input, Scancode::Escape);
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
     EXPECT_EQ(manager.getCurrentState()->getType(), StateType::Menu);
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "core/WorkerPool.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+// A brick field with enemies behind it and a seeded volley of bullets
+void setUpBattle(PlayingState& state) {
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->setPosition(Vector2(400.0f, 400.0f));
+
+    for (int x = 2; x < 24; x += 2) {
+        for (int cell = 0; cell < 4; ++cell) {
+            state.setTerrainCell(x + cell % 2, 10 + cell / 2, TerrainType::Brick);
+        }
+    }
+    state.setTerrainCell(12, 14, TerrainType::Steel);
+    for (int i = 0; i < 5; ++i) {
+        state.enemies_.push_back(std::make_unique<EnemyTank>(state.world_, Vector2(40.0f + 80.0f * i, 60.0f), EnemyType::Basic));
+        state.enemies_.back()->update(10.0f);  // Finish the spawn animation
+    }
+
+    RandomStream random(23);
+    for (int i = 0; i < 400; ++i) {
+        const Vector2 position(random.nextFloat() * 430.0f, 100.0f + random.nextFloat() * 330.0f);
+        const Direction direction = random.nextInt(0, 3) == 0 ? Direction::Left : Direction::Up;
+        auto bullet = std::make_unique<Bullet>(state.world_, position, direction, state.player1_.get());
+        bullet->setSpeed(4.0f + random.nextFloat() * 30.0f);
+        state.bullets_.push_back(std::move(bullet));
+    }
+}
+
+void runTicks(PlayingState& state, int ticks) {
+    for (int tick = 0; tick < ticks; ++tick) {
+        for (auto& bullet : state.bullets_) {
+            if (bullet->isAlive()) {
+                bullet->update(Constants::FIXED_DELTA_TIME);
+            }
+        }
+        state.checkCollisions();
+    }
+}
+
+} // namespace
+
+TEST(ContactPipelineTest, WorkerPoolCoversTheRangeInLaneOrder) {
+    WorkerPool pool(3);
+    ASSERT_EQ(pool.getLaneCount(), 4u);
+
+    for (size_t count : {0u, 1u, 3u, 1000u}) {
+        std::vector<std::vector<size_t>> lanes(pool.getLaneCount());
+        pool.parallelFor(count, [&](size_t lane, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                lanes[lane].push_back(i);
+            }
+        });
+
+        std::vector<size_t> joined;
+        for (const auto& lane : lanes) {
+            joined.insert(joined.end(), lane.begin(), lane.end());
+        }
+        ASSERT_EQ(joined.size(), count);
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(joined[i], i);
+        }
+    }
+}
+
+TEST(ContactPipelineTest, ParallelContactGenerationMatchesSerial) {
+    GameStateManager manager;
+    PlayingState serial(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    PlayingState parallel(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    setUpBattle(serial);
+    setUpBattle(parallel);
+    serial.parallelContactThreshold_ = SIZE_MAX;
+    parallel.parallelContactThreshold_ = 0;
+    parallel.collisionWorkers_ = std::make_unique<WorkerPool>(3);
+
+    runTicks(serial, 12);
+    runTicks(parallel, 12);
+    ASSERT_EQ(parallel.contactLanes_.size(), 4u);
+
+    ASSERT_EQ(serial.bullets_.size(), parallel.bullets_.size());
+    size_t hits = 0;
+    for (size_t i = 0; i < serial.bullets_.size(); ++i) {
+        EXPECT_EQ(serial.bullets_[i]->isAlive(), parallel.bullets_[i]->isAlive()) << "bullet " << i;
+        EXPECT_EQ(serial.bullets_[i]->getPosition(), parallel.bullets_[i]->getPosition()) << "bullet " << i;
+        hits += serial.bullets_[i]->isAlive() ? 0 : 1;
+    }
+    EXPECT_GT(hits, 100u);
+
+    EXPECT_EQ(serial.terrainMap_.getCells(), parallel.terrainMap_.getCells());
+    for (size_t i = 0; i < serial.enemies_.size(); ++i) {
+        EXPECT_EQ(serial.enemies_[i]->getHealth(), parallel.enemies_[i]->getHealth()) << "enemy " << i;
+    }
+    EXPECT_EQ(serial.enemyDefeats_.size(), parallel.enemyDefeats_.size());
+}
+
+TEST(ContactPipelineTest, SecondBulletPassesThroughTheCornerTheFirstDestroyed) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+
+    // Both bullets meet the lower-left corner first; the second must find
+    // the upper-left one once the first bullet has removed it.
+    for (int cell = 0; cell < 4; ++cell) {
+        state.setTerrainCell(6 + cell % 2, 6 + cell / 2, TerrainType::Brick);
+    }
+    for (int i = 0; i < 2; ++i) {
+        auto bullet = std::make_unique<Bullet>(state.world_, Vector2(6 * kCell + 4.0f, 8 * kCell + 2.0f), Direction::Up, nullptr);
+        bullet->setSpeed(20.0f);
+        state.bullets_.push_back(std::move(bullet));
+        state.bullets_.back()->update(Constants::FIXED_DELTA_TIME);
+    }
+
+    state.checkCollisions();
+
+    EXPECT_FALSE(state.bullets_[0]->isAlive());
+    EXPECT_FALSE(state.bullets_[1]->isAlive());
+    EXPECT_LT(state.bullets_[1]->getPosition().y, state.bullets_[0]->getPosition().y);
+    EXPECT_EQ(state.terrainMap_.get(6, 7), TerrainType::Empty);
+    EXPECT_EQ(state.terrainMap_.get(6, 6), TerrainType::Empty);
+}
+
+} // namespace tank::test
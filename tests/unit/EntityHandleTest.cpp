@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "core/EntityHandle.hpp"
+#include "entities/terrain/Base.hpp"
+#include "states/GameStateManager.hpp"
+
+#include <memory>
+
+namespace tank::test {
+
+TEST(EntityHandleTest, DestroyedHandlesGoStaleAndSlotsAreReused) {
+    EntityWorld world;
+    EntityHandleTable table;
+    Base first{world, 0, 0};
+    Base second{world, 0, 0};
+
+    const EntityHandle a = table.create(&first);
+    EXPECT_EQ(table.get(a), &first);
+    EXPECT_FALSE(table.isValid(EntityHandle())) << "null handle";
+
+    table.destroy(a);
+    EXPECT_EQ(table.get(a), nullptr);
+    table.destroy(a);  // Twice is harmless
+    EXPECT_EQ(table.getLiveCount(), 0u);
+
+    const EntityHandle b = table.create(&second);
+    EXPECT_EQ(b.index, a.index) << "the freed slot comes back";
+    EXPECT_NE(b, a);
+    EXPECT_EQ(table.get(a), nullptr) << "the old handle does not see the new entity";
+    EXPECT_EQ(table.get(b), &second);
+}
+
+TEST(EntityHandleTest, EntitiesAndTanksHoldAHandleForLife) {
+    EntityWorld world;
+    EntityHandle bulletHandle;
+    EntityHandle tankHandle;
+    {
+        PlayerTank player(world, 1, Vector2(100.0f, 100.0f));
+        Bullet bullet(world, Vector2(), Direction::Up, &player);
+        bulletHandle = bullet.getHandle();
+        tankHandle = player.getHandle();
+        EXPECT_EQ(world.getHandles().get(bulletHandle), &bullet);
+        EXPECT_EQ(bullet.getOwnerHandle(), tankHandle);
+        EXPECT_EQ(bullet.getOwner(), &player);
+    }
+    EXPECT_FALSE(world.getHandles().isValid(bulletHandle));
+    EXPECT_FALSE(world.getHandles().isValid(tankHandle));
+}
+
+TEST(EntityHandleTest, EachWorldKeepsItsOwnTable) {
+    EntityWorld first;
+    EntityWorld second;
+    Base a{first, 0, 0};
+    Base b{second, 0, 0};
+    Base c{second, 0, 0};
+
+    EXPECT_EQ(first.getHandles().getLiveCount(), 1u);
+    EXPECT_EQ(second.getHandles().getLiveCount(), 2u);
+    EXPECT_EQ(first.getHandles().get(a.getHandle()), &a);
+    EXPECT_EQ(second.getHandles().get(c.getHandle()), &c);
+
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    EXPECT_EQ(state.world_.getHandles().get(state.player1_->getHandle()), state.player1_.get());
+    EXPECT_EQ(second.getHandles().getLiveCount(), 2u) << "a running world leaves others alone";
+}
+
+TEST(EntityHandleTest, BulletOutlivingItsShooterIsOrphaned) {
+    EntityWorld world;
+    auto shooter = std::make_unique<EnemyTank>(world, Vector2(0.0f, 0.0f), EnemyType::Basic);
+    Bullet bullet(world, Vector2(100.0f, 100.0f), Direction::Up, shooter.get());
+    shooter.reset();
+
+    EXPECT_EQ(bullet.getOwner(), nullptr);
+    EXPECT_EQ(bullet.getTeam(), Team::Enemy);
+    bullet.die();  // Nobody left to notify
+    EXPECT_FALSE(bullet.isAlive());
+}
+
+TEST(EntityHandleTest, KillMultiplierCountsPerBulletNotPerAddress) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    PlayerTank& player = *state.player1_;
+    player.resetScore();
+
+    const auto addDeadEnemy = [&state](float x) -> EnemyTank& {
+        state.enemies_.push_back(std::make_unique<EnemyTank>(state.world_, Vector2(x, 100.0f), EnemyType::Basic));
+        state.enemies_.back()->die();
+        return *state.enemies_.back();
+    };
+
+    // One bullet through two enemies doubles both rewards
+    auto bullet = state.world_.create<Bullet>(Vector2(), Direction::Up, &player);
+    EnemyTank& first = addDeadEnemy(100.0f);
+    EnemyTank& second = addDeadEnemy(200.0f);
+    const int reward = first.getReward();
+    state.registerEnemyDefeat(first, player.getHandle(), bullet->getHandle());
+    state.registerEnemyDefeat(second, player.getHandle(), bullet->getHandle());
+
+    // A later bullet reuses the pooled slot, and so the address, of a spent one
+    const Bullet* spent = bullet.get();
+    bullet.reset();
+    auto reused = state.world_.create<Bullet>(Vector2(), Direction::Up, &player);
+    ASSERT_EQ(reused.get(), spent);
+    EnemyTank& third = addDeadEnemy(300.0f);
+    state.registerEnemyDefeat(third, player.getHandle(), reused->getHandle());
+
+    state.removeDeadEntities();
+    EXPECT_EQ(player.getScore(), reward * 2 * 2 + reward);
+    EXPECT_TRUE(state.enemies_.empty());
+    EXPECT_TRUE(state.enemyDefeats_.empty());
+}
+
+} // namespace tank::test
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "collision/CollisionManager.hpp"
+#include "collision/handlers/BulletBulletHandler.hpp"
+#include "collision/handlers/BulletTankHandler.hpp"
+#include "core/EntityWorld.hpp"
+#include "entities/effects/Effect.hpp"
+#include "entities/powerups/PowerUp.hpp"
+#include "entities/terrain/Base.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace tank::test {
+
+TEST(EntityKindDispatchTest, EntitiesCarryKindAndTeamTags) {
+    EntityWorld world;
+    PlayerTank player(world, 1, Vector2(100.0f, 100.0f));
+    EnemyTank enemy(world, Vector2(200.0f, 100.0f), EnemyType::Basic);
+    EXPECT_EQ(player.getKind(), EntityKind::PlayerTank);
+    EXPECT_EQ(player.getTeam(), Team::Player);
+    EXPECT_EQ(enemy.getKind(), EntityKind::EnemyTank);
+    EXPECT_EQ(enemy.getTeam(), Team::Enemy);
+
+    EXPECT_EQ(Base(world, 0, 0).getKind(), EntityKind::Base);
+    EXPECT_EQ(PowerUp(world, 0, 0, PowerUpType::Star).getKind(), EntityKind::PowerUp);
+    EXPECT_EQ(BulletExplosion(world, 0, 0).getKind(), EntityKind::Effect);
+}
+
+TEST(EntityKindDispatchTest, BulletKeepsItsTeamAfterTheOwnerIsDetached) {
+    EntityWorld world;
+    PlayerTank player(world, 1, Vector2(100.0f, 100.0f));
+    Bullet bullet(world, Vector2(), Direction::Up, &player);
+    EXPECT_EQ(bullet.getKind(), EntityKind::Bullet);
+    EXPECT_EQ(bullet.getTeam(), Team::Player);
+
+    bullet.clearOwner();
+    EXPECT_EQ(bullet.getOwner(), nullptr);
+    EXPECT_EQ(bullet.getTeam(), Team::Player);
+
+    EXPECT_EQ(Bullet(world, Vector2(), Direction::Up, nullptr).getTeam(), Team::Neutral);
+}
+
+TEST(EntityKindDispatchTest, HandlerTableRoutesBothArgumentOrders) {
+    CollisionManager manager;
+    manager.addHandler(std::make_unique<BulletBulletHandler>());
+    manager.addHandler(std::make_unique<BulletTankHandler>());
+
+    // Same-kind pairs are tried in both orders, as before
+    EXPECT_EQ(manager.getRouteCount(EntityKind::Bullet, EntityKind::Bullet), 2u);
+    EXPECT_EQ(manager.getRouteCount(EntityKind::Bullet, EntityKind::EnemyTank), 1u);
+    EXPECT_EQ(manager.getRouteCount(EntityKind::EnemyTank, EntityKind::Bullet), 1u);
+    EXPECT_EQ(manager.getRouteCount(EntityKind::Base, EntityKind::Bullet), 0u);
+    EXPECT_EQ(manager.getRouteCount(EntityKind::PowerUp, EntityKind::Bullet), 0u);
+    EXPECT_EQ(manager.getRouteCount(EntityKind::Effect, EntityKind::Effect), 0u);
+}
+
+TEST(EntityKindDispatchTest, ReversedPairReachesTheHandler) {
+    EntityWorld world;
+    CollisionManager manager;
+    manager.addHandler(std::make_unique<BulletTankHandler>());
+
+    PlayerTank player(world, 1, Vector2(200.0f, 200.0f));
+    std::vector<std::unique_ptr<IEntity>> entities;
+    entities.push_back(std::make_unique<EnemyTank>(world, Vector2(0.0f, 0.0f), EnemyType::Basic));
+    entities.push_back(std::make_unique<Bullet>(world, Vector2(2.0f, 2.0f), Direction::Up, &player));
+    auto* enemy = static_cast<EnemyTank*>(entities[0].get());
+    auto* bullet = static_cast<Bullet*>(entities[1].get());
+    const int healthBefore = enemy->getHealth();
+
+    manager.checkCollisionsInternal(entities);
+
+    EXPECT_FALSE(bullet->isAlive());
+    EXPECT_LT(enemy->getHealth(), healthBefore);
+}
+
+TEST(EntityKindDispatchTest, FriendlyFireUsesTeams) {
+    EntityWorld world;
+    BulletTankHandler handler;
+    EnemyTank shooter(world, Vector2(0.0f, 0.0f), EnemyType::Basic);
+    EnemyTank ally(world, Vector2(100.0f, 100.0f), EnemyType::Basic);
+    PlayerTank player(world, 1, Vector2(200.0f, 200.0f));
+    player.makeInvincible(0.0f);
+
+    Bullet enemyBullet(world, Vector2(100.0f, 100.0f), Direction::Up, &shooter);
+    shooter.die();
+    enemyBullet.clearOwner();  // The shooter is gone; the team remains
+    EXPECT_FALSE(handler.handle(enemyBullet, ally));
+    EXPECT_TRUE(enemyBullet.isAlive());
+
+    const int healthBefore = player.getHealth();
+    EXPECT_TRUE(handler.handle(enemyBullet, player));
+    EXPECT_LT(player.getHealth(), healthBefore);
+}
+
+} // namespace tank::test
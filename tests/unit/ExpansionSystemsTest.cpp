@@ -22,10 +22,10 @@ TEST(ExpansionSystemsTest, EnemyTypesReceiveDistinctBehaviorStrategies) {
     PlayingState state(manager, 1, false, false);
     state.enter();
 
-    EnemyTank basic(Vector2(0.0f, 0.0f), EnemyType::Basic);
-    EnemyTank fast(Vector2(0.0f, 0.0f), EnemyType::Fast);
-    EnemyTank power(Vector2(0.0f, 0.0f), EnemyType::Power);
-    EnemyTank heavy(Vector2(0.0f, 0.0f), EnemyType::Heavy);
+    EnemyTank basic(state.world_, Vector2(0.0f, 0.0f), EnemyType::Basic);
+    EnemyTank fast(state.world_, Vector2(0.0f, 0.0f), EnemyType::Fast);
+    EnemyTank power(state.world_, Vector2(0.0f, 0.0f), EnemyType::Power);
+    EnemyTank heavy(state.world_, Vector2(0.0f, 0.0f), EnemyType::Heavy);
     state.configureEnemyAI(basic);
     state.configureEnemyAI(fast);
     state.configureEnemyAI(power);
@@ -64,12 +64,12 @@ TEST(ExpansionSystemsTest, EnemyKillAwardsScoreAndMultiKillUsesSameDamageEvent)
     state.enemies_.clear();
     state.enemiesAlive_ = 2;
 
-    int damageEvent = 0;
+    const Bullet damageEvent(state.world_, Vector2(), Direction::Up, state.player1_.get());
     for (int i = 0; i < 2; ++i) {
-        auto enemy = std::make_unique<EnemyTank>(Vector2(100.0f + i * 40.0f, 100.0f), EnemyType::Basic);
+        auto enemy = std::make_unique<EnemyTank>(state.world_, Vector2(100.0f + i * 40.0f, 100.0f), EnemyType::Basic);
         EnemyTank* rawEnemy = enemy.get();
         state.enemies_.push_back(std::move(enemy));
-        state.registerEnemyDefeat(*rawEnemy, state.player1_.get(), &damageEvent);
+        state.registerEnemyDefeat(*rawEnemy, state.player1_->getHandle(), damageEvent.getHandle());
         rawEnemy->die();
     }
 
@@ -90,20 +90,20 @@ TEST(ExpansionSystemsTest, SettingsMenuChangesVolumeAndDifficulty) {
 
     ASSERT_TRUE(menu.settingsOpen_);
     ScriptedInput input;
-    input.setKeyDown(SDL_SCANCODE_RIGHT, true);
+    input.setKeyDown(Scancode::Right, true);
     menu.handleInput(input);
     input.advanceFrame();
 
     EXPECT_FLOAT_EQ(manager.getMasterVolume(), 1.0f);
 
-    input.setKeyDown(SDL_SCANCODE_RIGHT, false);
+    input.setKeyDown(Scancode::Right, false);
     input.advanceFrame();
-    input.setKeyDown(SDL_SCANCODE_DOWN, true);
+    input.setKeyDown(Scancode::Down, true);
     menu.handleInput(input);
     input.advanceFrame();
-    input.setKeyDown(SDL_SCANCODE_DOWN, false);
+    input.setKeyDown(Scancode::Down, false);
     input.advanceFrame();
-    input.setKeyDown(SDL_SCANCODE_RIGHT, true);
+    input.setKeyDown(Scancode::Right, true);
     menu.handleInput(input);
 
     EXPECT_EQ(manager.getDifficulty(), GameDifficulty::Hard);
@@ -132,10 +132,11 @@ TEST(ExpansionSystemsTest, StateManagerPersistsHighScoreAndUnlockedStageWhenConf
 }
 
 TEST(ExpansionSystemsTest, RangedAIKeepsFiringBandAroundBase) {
+    EntityWorld world;
     const Vector2 base(100.0f, 100.0f);
 
     // Far beyond MAX_RANGE: closes in towards the base.
-    EnemyTank far(Vector2(100.0f, 300.0f), EnemyType::Power);
+    EnemyTank far(world, Vector2(100.0f, 300.0f), EnemyType::Power);
     RangedAI farAi;
     farAi.setTarget(base);
     farAi.update(far, 0.016f);
@@ -143,7 +144,7 @@ TEST(ExpansionSystemsTest, RangedAIKeepsFiringBandAroundBase) {
     EXPECT_LT(far.getPosition().y, 300.0f);
 
     // Closer than MIN_RANGE: backs away from the base.
-    EnemyTank close(Vector2(100.0f, 120.0f), EnemyType::Power);
+    EnemyTank close(world, Vector2(100.0f, 120.0f), EnemyType::Power);
     RangedAI closeAi;
     closeAi.setTarget(base);
     closeAi.update(close, 0.016f);
@@ -151,7 +152,7 @@ TEST(ExpansionSystemsTest, RangedAIKeepsFiringBandAroundBase) {
     EXPECT_GT(close.getPosition().y, 120.0f);
 
     // Inside the band: holds position but faces the base.
-    EnemyTank inBand(Vector2(100.0f, 200.0f), EnemyType::Power);
+    EnemyTank inBand(world, Vector2(100.0f, 200.0f), EnemyType::Power);
     RangedAI bandAi;
     bandAi.setTarget(base);
     bandAi.update(inBand, 0.016f);
@@ -161,10 +162,11 @@ TEST(ExpansionSystemsTest, RangedAIKeepsFiringBandAroundBase) {
 }
 
 TEST(ExpansionSystemsTest, DirectAIAlwaysPressesTowardBase) {
+    EntityWorld world;
     const Vector2 base(204.0f, 408.0f);
 
     // Far away: moves straight at the base.
-    EnemyTank far(Vector2(100.0f, 100.0f), EnemyType::Heavy);
+    EnemyTank far(world, Vector2(100.0f, 100.0f), EnemyType::Heavy);
     DirectAI farAi;
     farAi.setTarget(base);
     farAi.update(far, 0.016f);
@@ -172,7 +174,7 @@ TEST(ExpansionSystemsTest, DirectAIAlwaysPressesTowardBase) {
     EXPECT_GT(far.getPosition().y, 100.0f);
 
     // Even point-blank it keeps pushing instead of holding a position.
-    EnemyTank close(Vector2(200.0f, 400.0f), EnemyType::Heavy);
+    EnemyTank close(world, Vector2(200.0f, 400.0f), EnemyType::Heavy);
     DirectAI closeAi;
     closeAi.setTarget(base);
     closeAi.update(close, 0.016f);
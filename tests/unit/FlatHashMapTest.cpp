@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include "utils/FlatHashMap.hpp"
+#include "utils/Random.hpp"
+
+#include <map>
+
+namespace tank::test {
+
+TEST(FlatHashMapTest, MatchesStdMapUnderChurn) {
+    FlatHashMap<int, int> map(8);
+    std::map<int, int> expected;
+    RandomStream random(11);
+    for (int step = 0; step < 5000; ++step) {
+        const int key = random.nextInt(0, 200);
+        if (random.nextInt(0, 2) == 0) {
+            map.erase(key);
+            expected.erase(key);
+        } else {
+            map[key] = step;
+            expected[key] = step;
+        }
+        if (step % 500 == 499) {
+            const int cut = random.nextInt(0, 200);
+            map.eraseIf([cut](int k, int) { return k < cut; });
+            expected.erase(expected.begin(), expected.lower_bound(cut));
+        }
+    }
+
+    ASSERT_EQ(map.size(), expected.size());
+    for (int key = 0; key <= 200; ++key) {
+        const int* value = map.find(key);
+        const auto found = expected.find(key);
+        ASSERT_EQ(value != nullptr, found != expected.end()) << "key " << key;
+        if (value) {
+            EXPECT_EQ(*value, found->second) << "key " << key;
+        }
+    }
+}
+
+TEST(FlatHashMapTest, ForEachVisitsEveryEntryOnceAndClearEmpties) {
+    FlatHashMap<int, int> map(4);
+    for (int key = 0; key < 100; ++key) {
+        map[key * 7] = key;
+    }
+    int visits = 0;
+    int sum = 0;
+    map.forEach([&](int key, int value) {
+        EXPECT_EQ(key, value * 7);
+        ++visits;
+        sum += value;
+    });
+    EXPECT_EQ(visits, 100);
+    EXPECT_EQ(sum, 99 * 100 / 2);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(7), nullptr);
+}
+
+} // namespace tank::test
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "core/FrameArena.hpp"
+#include "mocks/AllocationCounter.hpp"
+#include "states/GameStateManager.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+void tick(PlayingState& state) {
+    for (auto& bullet : state.bullets_) {
+        if (bullet->isAlive()) {
+            bullet->update(Constants::FIXED_DELTA_TIME);
+        }
+    }
+    state.checkCollisions();
+    state.removeDeadEntities();
+}
+
+} // namespace
+
+TEST(FrameArenaTest, AllocationsAreAlignedAndDisjoint) {
+    FrameArena arena(256);
+    auto* a = static_cast<unsigned char*>(arena.allocate(3, 1));
+    auto* b = static_cast<double*>(arena.allocate(sizeof(double) * 4, alignof(double)));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(double), 0u);
+    EXPECT_GE(reinterpret_cast<unsigned char*>(b), a + 3);
+    EXPECT_GE(arena.getBytesUsed(), 3u + sizeof(double) * 4);
+}
+
+TEST(FrameArenaTest, OversizedRequestsGetTheirOwnBlockAndResetMergesBlocks) {
+    FrameArena arena(256);
+    arena.allocate(200, 8);
+    arena.allocate(1000, 8);
+    EXPECT_EQ(arena.getBlockCount(), 2u);
+    const std::size_t capacity = arena.getCapacity();
+
+    arena.reset();
+    EXPECT_EQ(arena.getBlockCount(), 1u);
+    EXPECT_EQ(arena.getCapacity(), capacity);
+    EXPECT_EQ(arena.getBytesUsed(), 0u);
+
+    // The same tick's worth of requests now fits in one block
+    arena.allocate(200, 8);
+    arena.allocate(1000, 8);
+    EXPECT_EQ(arena.getBlockCount(), 1u);
+}
+
+TEST(FrameArenaTest, NewestAllocationCanBeHandedBack) {
+    FrameArena arena(4096);
+    void* kept = arena.allocate(64, 8);
+    void* temporary = arena.allocate(128, 8);
+    arena.deallocate(temporary, 128);
+    EXPECT_EQ(arena.allocate(128, 8), temporary);
+
+    // Older allocations stay put until reset()
+    const std::size_t used = arena.getBytesUsed();
+    arena.deallocate(kept, 64);
+    EXPECT_EQ(arena.getBytesUsed(), used);
+}
+
+TEST(FrameArenaTest, FrameVectorGrowsInsideTheArena) {
+    FrameArena arena(4096);
+    FrameVector<int> values{FrameAllocator<int>(arena)};
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(values[i], i);
+    }
+    EXPECT_GE(arena.getBytesUsed(), values.capacity() * sizeof(int));
+    EXPECT_EQ(arena.getBlockCount(), 1u);
+}
+
+TEST(FrameArenaTest, SteadyStateCollisionPassMakesNoHeapAllocations) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->setPosition(Vector2(20.0f, 400.0f));
+
+    // Bullets flying up open columns, never hitting anything during the test
+    for (int i = 0; i < 300; ++i) {
+        auto bullet = std::make_unique<Bullet>(state.world_, Vector2((i % 20) * kCell + 2.0f, 100.0f + (i / 20) * 20.0f),
+                                               Direction::Up, nullptr);
+        bullet->setSpeed(2.0f);
+        state.bullets_.push_back(std::move(bullet));
+    }
+
+    {
+        AllocationCounter probe;
+        const auto counted = std::make_unique<int>(1);
+        ASSERT_EQ(probe.count(), 1) << "counting operator new is not in use";
+    }
+
+    for (size_t threshold : {state.bullets_.size() + 1, size_t{1}}) {
+        state.parallelContactThreshold_ = threshold;  // Serial, then split over workers
+        for (int i = 0; i < 3; ++i) {
+            tick(state);
+        }
+
+        AllocationCounter counter;
+        for (int i = 0; i < 10; ++i) {
+            tick(state);
+        }
+        EXPECT_EQ(counter.count(), 0) << "threshold " << threshold;
+    }
+    for (const auto& bullet : state.bullets_) {
+        EXPECT_TRUE(bullet->isAlive());
+    }
+}
+
+} // namespace tank::test
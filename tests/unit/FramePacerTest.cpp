@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "core/FramePacer.hpp"
+
+namespace tank::test {
+
+TEST(FramePacerTest, LatencyTrackerReportsPercentiles) {
+    LatencyTracker tracker;
+    for (int i = 1; i <= 100; ++i) {
+        tracker.addSample(i / 1000.0);
+    }
+
+    EXPECT_EQ(tracker.getSampleCount(), 100u);
+    EXPECT_DOUBLE_EQ(tracker.getLatest(), 0.100);
+    EXPECT_NEAR(tracker.getAverage(), 0.0505, 1e-9);
+    EXPECT_DOUBLE_EQ(tracker.getMax(), 0.100);
+    EXPECT_NEAR(tracker.getPercentile(50.0), 0.050, 0.0011);
+    EXPECT_NEAR(tracker.getPercentile(99.0), 0.099, 0.0011);
+}
+
+TEST(FramePacerTest, LatencyTrackerKeepsRollingWindow) {
+    LatencyTracker tracker;
+    for (size_t i = 0; i < LatencyTracker::CAPACITY; ++i) {
+        tracker.addSample(1.0);
+    }
+    for (size_t i = 0; i < LatencyTracker::CAPACITY; ++i) {
+        tracker.addSample(0.002);
+    }
+
+    EXPECT_EQ(tracker.getSampleCount(), LatencyTracker::CAPACITY);
+    EXPECT_DOUBLE_EQ(tracker.getMax(), 0.002);
+}
+
+TEST(FramePacerTest, MeasuresInputToPresentLatency) {
+    FramePacer pacer(PacingMode::Uncapped);
+    pacer.markInputSampled();
+    const double sampledAt = pacer.now();
+    while (pacer.now() - sampledAt < 0.003) {
+    }
+    pacer.markPresented();
+
+    ASSERT_EQ(pacer.getInputLatency().getSampleCount(), 1u);
+    EXPECT_GE(pacer.getInputLatency().getLatest(), 0.003);
+
+    // A present without a fresh input sample adds no latency sample.
+    pacer.markPresented();
+    EXPECT_EQ(pacer.getInputLatency().getSampleCount(), 1u);
+    EXPECT_EQ(pacer.getFrameTimes().getSampleCount(), 1u);
+}
+
+TEST(FramePacerTest, LimiterHoldsTargetRate) {
+    FramePacer pacer(PacingMode::Limiter, 200.0);
+    pacer.waitForNextFrame();  // Establish the schedule
+    const double start = pacer.now();
+    constexpr int FRAMES = 10;
+    for (int i = 0; i < FRAMES; ++i) {
+        pacer.waitForNextFrame();
+    }
+    const double elapsed = pacer.now() - start;
+
+    EXPECT_GE(elapsed, FRAMES * 0.005 - 0.0005);
+}
+
+TEST(FramePacerTest, UncappedNeverWaits) {
+    FramePacer pacer(PacingMode::Uncapped, 10.0);
+    const double start = pacer.now();
+    for (int i = 0; i < 5; ++i) {
+        pacer.waitForNextFrame();
+    }
+    EXPECT_LT(pacer.now() - start, 0.05);
+}
+
+TEST(FramePacerTest, ParsesModeNames) {
+    PacingMode mode = PacingMode::VSync;
+    EXPECT_TRUE(FramePacer::parseMode("limit", mode));
+    EXPECT_EQ(mode, PacingMode::Limiter);
+    EXPECT_TRUE(FramePacer::parseMode("uncapped", mode));
+    EXPECT_EQ(mode, PacingMode::Uncapped);
+    EXPECT_FALSE(FramePacer::parseMode("fast", mode));
+    EXPECT_STREQ(FramePacer::modeName(PacingMode::VSync), "vsync");
+}
+
+} // namespace tank::test
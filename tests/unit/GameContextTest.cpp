@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "core/HeadlessRunner.hpp"
+#include "states/GameStateManager.hpp"
+#include "mocks/MockAudioPlayer.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tank::test {
+
+TEST(GameContextTest, EmptyContextIsSilent) {
+    GameContext context;
+    EXPECT_FALSE(context.hasAudio());
+    EXPECT_EQ(context.getRenderer(), nullptr);
+
+    context.playSound(SoundId::Explosion);  // Must not crash
+    context.playMusic("assets/audio/music/battle_theme.wav");
+}
+
+TEST(GameContextTest, EachWorldUsesItsOwnAudio) {
+    auto audioA = std::make_shared<MockAudioPlayer>();
+    auto audioB = std::make_shared<MockAudioPlayer>();
+    GameStateManager managerA(GameContext(nullptr, nullptr, audioA));
+    GameStateManager managerB(GameContext(nullptr, nullptr, audioB));
+
+    PlayingState worldA(managerA, 1, false);
+    PlayingState worldB(managerB, 1, false);
+    worldA.enter();
+    worldB.enter();
+
+    ASSERT_EQ(audioA->getMusic().size(), 1u);
+    ASSERT_EQ(audioB->getMusic().size(), 1u);
+
+    worldA.base_->takeDamage(1000);
+    worldA.checkGameState(0.0f);
+
+    ASSERT_FALSE(audioA->getSounds().empty());
+    EXPECT_EQ(audioA->getSounds().back(), SoundId::GameOver);
+    EXPECT_TRUE(audioB->getSounds().empty());
+}
+
+TEST(GameContextTest, WorldsRunInParallelWithoutSharedState) {
+    HeadlessOptions options;
+    options.level = 1;
+    options.ticks = 900;
+    options.seed = 11;
+    options.twoPlayer = true;
+
+    const HeadlessSummary reference = HeadlessRunner(options).run();
+
+    constexpr int WORLD_COUNT = 4;
+    std::vector<HeadlessSummary> results(WORLD_COUNT);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < WORLD_COUNT; ++i) {
+        workers.emplace_back([&results, &options, i]() {
+            results[i] = HeadlessRunner(options).run();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (const auto& result : results) {
+        EXPECT_EQ(result.ticks, reference.ticks);
+        EXPECT_EQ(result.outcome, reference.outcome);
+        EXPECT_EQ(result.player1Score, reference.player1Score);
+        EXPECT_EQ(result.player2Score, reference.player2Score);
+    }
+}
+
+} // namespace tank::test
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include "core/HeadlessRunner.hpp"
+
+#include <string>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+bool parse(std::vector<std::string> args, HeadlessOptions& options, std::string& error) {
+    args.insert(args.begin(), "TankGame");
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+        argv.push_back(arg.data());
+    }
+    return HeadlessRunner::parseArguments(static_cast<int>(argv.size()), argv.data(), options, error);
+}
+
+} // namespace
+
+TEST(HeadlessRunnerTest, ParsesAllOptions) {
+    HeadlessOptions options;
+    std::string error;
+    ASSERT_TRUE(parse({"--headless", "--level", "3", "--ticks", "500", "--seed", "42", "--players", "2"},
+                      options, error)) << error;
+
+    EXPECT_EQ(options.level, 3);
+    EXPECT_EQ(options.ticks, 500);
+    EXPECT_EQ(options.seed, 42u);
+    EXPECT_TRUE(options.twoPlayer);
+}
+
+TEST(HeadlessRunnerTest, RejectsMalformedArguments) {
+    HeadlessOptions options;
+    std::string error;
+    EXPECT_FALSE(parse({"--headless", "--ticks", "abc"}, options, error));
+    EXPECT_FALSE(parse({"--headless", "--players", "3"}, options, error));
+    EXPECT_FALSE(parse({"--headless", "--level"}, options, error));
+    EXPECT_FALSE(parse({"--headless", "--fullscreen"}, options, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(HeadlessRunnerTest, DetectsHeadlessFlag) {
+    std::string program = "TankGame";
+    std::string flag = "--headless";
+    char* withFlag[] = {program.data(), flag.data()};
+    char* withoutFlag[] = {program.data()};
+
+    EXPECT_TRUE(HeadlessRunner::isRequested(2, withFlag));
+    EXPECT_FALSE(HeadlessRunner::isRequested(1, withoutFlag));
+}
+
+TEST(HeadlessRunnerTest, SameSeedReplaysTheSameMatch) {
+    HeadlessOptions options;
+    options.level = 1;
+    options.ticks = 1200;
+    options.seed = 7;
+    options.twoPlayer = true;
+
+    const HeadlessSummary first = HeadlessRunner(options).run();
+    const HeadlessSummary second = HeadlessRunner(options).run();
+
+    EXPECT_GT(first.ticks, 0);
+    EXPECT_LE(first.ticks, options.ticks);
+    EXPECT_EQ(first.ticks, second.ticks);
+    EXPECT_EQ(first.outcome, second.outcome);
+    EXPECT_EQ(first.player1Score, second.player1Score);
+    EXPECT_EQ(first.player2Score, second.player2Score);
+}
+
+TEST(HeadlessRunnerTest, MissingLevelFailsInsteadOfPlayingABlankMap) {
+    HeadlessOptions options;
+    options.level = 999;  // No such level file
+
+    const HeadlessSummary summary = HeadlessRunner(options).run();
+    EXPECT_EQ(summary.outcome, HeadlessOutcome::LevelLoadFailed);
+    EXPECT_EQ(summary.ticks, 0);
+
+    std::string program = "TankGame";
+    std::string flag = "--headless";
+    std::string levelFlag = "--level";
+    std::string level = "999";
+    char* argv[] = {program.data(), flag.data(), levelFlag.data(), level.data()};
+    EXPECT_NE(HeadlessRunner::runFromCommandLine(4, argv), 0);
+}
+
+} // namespace tank::test
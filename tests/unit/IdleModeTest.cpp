@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/MenuState.hpp"
+#include "states/PlayingState.hpp"
+#include "states/ScoreState.hpp"
+#undef private
+#undef protected
+
+#include "states/GameStateManager.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tank::test {
+
+TEST(IdleModeTest, MenuIsIdleUntilNextIconFrameOnceFadedIn) {
+    GameStateManager manager;
+    manager.pushState(std::make_unique<MenuState>(manager));
+    manager.update(0.0f);
+    EXPECT_FLOAT_EQ(manager.getIdleRedrawInterval(), 0.0f) << "fade-in animates every frame";
+
+    for (int i = 0; i < 60; ++i) {
+        manager.update(Constants::FIXED_DELTA_TIME);
+    }
+    const float interval = manager.getIdleRedrawInterval();
+    EXPECT_GT(interval, 0.0f);
+    EXPECT_LE(interval, MenuState::ICON_FRAME_SECONDS);
+
+    // Sleeping for the interval lands on the next tread frame
+    auto* menu = dynamic_cast<MenuState*>(manager.getCurrentState());
+    ASSERT_NE(menu, nullptr);
+    const int frameBefore = static_cast<int>(menu->animTimer_ / MenuState::ICON_FRAME_SECONDS);
+    manager.update(interval + 0.001f);
+    EXPECT_EQ(static_cast<int>(menu->animTimer_ / MenuState::ICON_FRAME_SECONDS), frameBefore + 1);
+}
+
+TEST(IdleModeTest, MenuWakesForEveryCursorBounceStep) {
+    GameStateManager manager;
+    manager.pushState(std::make_unique<MenuState>(manager));
+    manager.update(1.0f);  // Finish the fade-in
+    auto* menu = dynamic_cast<MenuState*>(manager.getCurrentState());
+    ASSERT_NE(menu, nullptr);
+
+    // The outermost pixel only shows at the very crest, which is not woken for
+    const auto cursorOffset = [menu] {
+        const int offset = static_cast<int>(std::sin(menu->cursorPulse_) * MenuState::CURSOR_BOUNCE_PIXELS);
+        return std::clamp(offset, -2, 2);
+    };
+    // Over two bounce cycles the drawn offset never changes between wakes
+    int wakes = 0;
+    while (menu->cursorPulse_ < 4.0f * 3.14159265f) {
+        const float interval = menu->getIdleRedrawInterval();
+        ASSERT_GT(interval, 0.0f);
+        const int offset = cursorOffset();
+        for (int i = 0; i < 8; ++i) {
+            manager.update(interval / 10.0f);
+            EXPECT_EQ(cursorOffset(), offset) << "bounce moved before the wake-up";
+        }
+        manager.update(interval * 2.0f / 10.0f + 1e-5f);
+        ++wakes;
+    }
+    // More often than the 4 Hz icon frames alone would wake
+    EXPECT_GT(wakes, static_cast<int>(4.0f * 3.14159265f / MenuState::CURSOR_PULSE_SPEED * 4.0f));
+}
+
+TEST(IdleModeTest, PausedPlayingStateIsIdleButRunningAndGameOverAreNot) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
+
+    EXPECT_FLOAT_EQ(state.getIdleRedrawInterval(), 0.0f);
+
+    state.paused_ = true;
+    EXPECT_FLOAT_EQ(state.getIdleRedrawInterval(), Constants::IDLE_REDRAW_INTERVAL);
+
+    state.gameOver_ = true;
+    EXPECT_FLOAT_EQ(state.getIdleRedrawInterval(), 0.0f);
+}
+
+TEST(IdleModeTest, ScoreStateIsIdleOnceTallyCompletes) {
+    GameStateManager manager;
+    ScoreState score(manager, /*levelNumber=*/1, /*victory=*/true);
+
+    EXPECT_FLOAT_EQ(score.getIdleRedrawInterval(), 0.0f);
+    score.animationComplete_ = true;
+    EXPECT_FLOAT_EQ(score.getIdleRedrawInterval(), Constants::IDLE_REDRAW_INTERVAL);
+}
+
+TEST(IdleModeTest, PendingTransitionIsNeverIdle) {
+    GameStateManager manager;
+    manager.pushState(std::make_unique<ScoreState>(manager, /*levelNumber=*/1, /*victory=*/true));
+    manager.update(0.0f);
+    auto* score = dynamic_cast<ScoreState*>(manager.getCurrentState());
+    ASSERT_NE(score, nullptr);
+    score->animationComplete_ = true;
+    ASSERT_GT(manager.getIdleRedrawInterval(), 0.0f);
+
+    manager.changeState(std::make_unique<MenuState>(manager));
+    EXPECT_FLOAT_EQ(manager.getIdleRedrawInterval(), 0.0f);
+}
+
+} // namespace tank::test
@@ -9,20 +9,23 @@ namespace tank::test {
 TEST(InputManagerKeycodeTest, KeycodeQueriesUseKeycodeState) {
     InputManager input;
 
-    input.currentKeycodes_.clear();
-    input.previousKeycodes_.clear();
-    input.eventKeycodes_.clear();
+    const int slot = InputManager::keycodeSlot(Keycode::W);
+    ASSERT_GE(slot, 0);
 
-    input.currentKeycodes_.insert(SDLK_w);
-    input.eventKeycodes_.insert(SDLK_w);
+    input.currentKeycodes_.reset();
+    input.previousKeycodes_.reset();
+    input.pressedKeycodes_.reset();
 
-    EXPECT_TRUE(input.isKeyDown(SDLK_w));
-    EXPECT_TRUE(input.isKeyPressed(SDLK_w));
-    EXPECT_FALSE(input.isKeyDown(SDL_SCANCODE_W));
+    input.currentKeycodes_.set(slot);
+    input.pressedKeycodes_.set(slot);
 
-    input.previousKeycodes_.insert(SDLK_w);
-    input.currentKeycodes_.clear();
-    EXPECT_TRUE(input.isKeyReleased(SDLK_w));
+    EXPECT_TRUE(input.isKeyDown(Keycode::W));
+    EXPECT_TRUE(input.isKeyPressed(Keycode::W));
+    EXPECT_FALSE(input.isKeyDown(Scancode::W));
+
+    input.previousKeycodes_.set(slot);
+    input.currentKeycodes_.reset();
+    EXPECT_TRUE(input.isKeyReleased(Keycode::W));
 }
 
 } // namespace tank::test
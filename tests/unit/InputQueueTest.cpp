@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "input/InputManager.hpp"
+
+namespace tank::test {
+
+namespace {
+
+InputEvent keyEvent(InputEvent::Type type, Scancode scancode, Keycode keycode, uint32_t timestamp) {
+    InputEvent event;
+    event.type = type;
+    event.scancode = scancode;
+    event.keycode = keycode;
+    event.timestamp = timestamp;
+    return event;
+}
+
+} // namespace
+
+TEST(InputQueueTest, TickConsumesOnlyEventsBeforeItsCutoff) {
+    InputManager input;
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::Space, Keycode::Space, 100));
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::W, Keycode::W, 120));
+
+    input.beginTick(110);
+    EXPECT_TRUE(input.isKeyPressed(Scancode::Space));
+    EXPECT_TRUE(input.isKeyDown(Scancode::Space));
+    EXPECT_FALSE(input.isKeyDown(Scancode::W));
+    EXPECT_EQ(input.getPendingEventCount(), 1u);
+
+    input.beginTick(127);
+    EXPECT_FALSE(input.isKeyPressed(Scancode::Space));
+    EXPECT_TRUE(input.isKeyDown(Scancode::Space));
+    EXPECT_TRUE(input.isKeyPressed(Scancode::W));
+    EXPECT_TRUE(input.isKeyPressed(Keycode::W));
+    EXPECT_EQ(input.getPendingEventCount(), 0u);
+}
+
+TEST(InputQueueTest, PressEdgeIsNotRepeatedAcrossCatchUpTicks) {
+    InputManager input;
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::Return, Keycode::Return, 50));
+
+    int pressedTicks = 0;
+    for (uint32_t tick = 60; tick <= 110; tick += 16) {
+        input.beginTick(tick);
+        pressedTicks += input.isKeyPressed(Scancode::Return) ? 1 : 0;
+    }
+    EXPECT_EQ(pressedTicks, 1);
+    EXPECT_TRUE(input.isKeyDown(Scancode::Return));
+}
+
+TEST(InputQueueTest, TapWithinOneTickStillRegistersPress) {
+    InputManager input;
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::Space, Keycode::Space, 10));
+    input.queueEvent(keyEvent(InputEvent::Type::KeyUp, Scancode::Space, Keycode::Space, 12));
+
+    input.beginTick(16);
+    EXPECT_TRUE(input.isKeyPressed(Scancode::Space));
+    EXPECT_FALSE(input.isKeyDown(Scancode::Space));
+
+    input.beginTick(32);
+    EXPECT_FALSE(input.isKeyPressed(Scancode::Space));
+}
+
+TEST(InputQueueTest, ReleaseEdgeAndMouseButtonsArePerTick) {
+    InputManager input;
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::A, Keycode::A, 0));
+    InputEvent click;
+    click.type = InputEvent::Type::MouseButtonDown;
+    click.mouseButton = MouseButton::Left;
+    click.mouseX = 40;
+    click.mouseY = 30;
+    click.timestamp = 0;
+    input.queueEvent(click);
+    input.beginTick(0);
+    EXPECT_TRUE(input.isMouseButtonPressed(MouseButton::Left));
+    EXPECT_EQ(input.getMouseX(), 40);
+
+    input.queueEvent(keyEvent(InputEvent::Type::KeyUp, Scancode::A, Keycode::A, 20));
+    input.beginTick(16);
+    EXPECT_FALSE(input.isMouseButtonPressed(MouseButton::Left));
+    EXPECT_TRUE(input.isMouseButtonDown(MouseButton::Left));
+    EXPECT_FALSE(input.isKeyReleased(Keycode::A));
+
+    input.beginTick(33);
+    EXPECT_TRUE(input.isKeyReleased(Keycode::A));
+    EXPECT_FALSE(input.isKeyDown(Scancode::A));
+}
+
+TEST(InputQueueTest, CutoffComparisonSurvivesTickWrapAround) {
+    InputManager input;
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::D, Keycode::D, 0xFFFFFFF0u));
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::S, Keycode::S, 5));
+
+    input.beginTick(0xFFFFFFF8u);
+    EXPECT_TRUE(input.isKeyDown(Scancode::D));
+    EXPECT_FALSE(input.isKeyDown(Scancode::S));
+
+    input.beginTick(8);
+    EXPECT_TRUE(input.isKeyDown(Scancode::S));
+}
+
+TEST(InputQueueTest, ScancodeDerivedKeycodesHaveTheirOwnSlots) {
+    InputManager input;
+    const Keycode f3 = static_cast<Keycode>((1 << 30) | static_cast<int32_t>(Scancode::F3));
+    input.queueEvent(keyEvent(InputEvent::Type::KeyDown, Scancode::F3, f3, 0));
+    input.beginTick(0);
+
+    EXPECT_TRUE(input.isKeyPressed(f3));
+    EXPECT_FALSE(input.isKeyDown(static_cast<Keycode>('<')));
+    EXPECT_FALSE(input.isKeyDown(Keycode::Unknown));
+}
+
+} // namespace tank::test
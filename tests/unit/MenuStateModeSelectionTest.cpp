@@ -14,7 +14,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -33,7 +33,7 @@ TEST(MenuStateModeSelectionTest, Press1StartsCampaign) {
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Menu);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_1);
+    pressKeyOnce(manager, input, Scancode::Num1);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -49,7 +49,7 @@ TEST(MenuStateModeSelectionTest, Press2StartsSurvival) {
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Menu);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_2);
+    pressKeyOnce(manager, input, Scancode::Num2);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -65,7 +65,7 @@ TEST(MenuStateModeSelectionTest, PressCStartsConstruction) {
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Menu);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_C);
+    pressKeyOnce(manager, input, Scancode::C);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -81,8 +81,8 @@ TEST(MenuStateModeSelectionTest, Toggle2PThenStartSurvivalCreatesPlayer2) {
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Menu);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_P);
-    pressKeyOnce(manager, input, SDL_SCANCODE_2);
+    pressKeyOnce(manager, input, Scancode::P);
+    pressKeyOnce(manager, input, Scancode::Num2);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -109,7 +109,7 @@ TEST(MenuStateModeSelectionTest, MenuTankCountMatchesSelectedPlayerMode) {
     EXPECT_EQ(onePlayerTank.destH, 26);
 
     ScriptedInput input;
-    input.setKeyDown(SDL_SCANCODE_P, true);
+    input.setKeyDown(Scancode::P, true);
     menu.handleInput(input);
 
     renderer.resetDrawCallCount();
@@ -124,21 +124,21 @@ TEST(MenuStateModeSelectionTest, MuteShortcutAndButtonRestorePreviousVolume) {
     menu.enter();
     ScriptedInput input;
 
-    input.setKeyDown(SDL_SCANCODE_M, true);
+    input.setKeyDown(Scancode::M, true);
     menu.handleInput(input);
     EXPECT_TRUE(manager.isMuted());
 
     input.advanceFrame();
-    input.setKeyDown(SDL_SCANCODE_M, false);
+    input.setKeyDown(Scancode::M, false);
     input.advanceFrame();
-    input.setKeyDown(SDL_SCANCODE_M, true);
+    input.setKeyDown(Scancode::M, true);
     menu.handleInput(input);
     EXPECT_FALSE(manager.isMuted());
     EXPECT_FLOAT_EQ(manager.getMasterVolume(), 0.6f);
 
     input.reset();
     input.setMousePosition(450, 20);
-    input.setMouseButtonDown(SDL_BUTTON_LEFT, true);
+    input.setMouseButtonDown(MouseButton::Left, true);
     menu.handleInput(input);
     EXPECT_TRUE(manager.isMuted());
 }
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "core/EntityWorld.hpp"
+#include "core/ObjectPool.hpp"
+#include "mocks/AllocationCounter.hpp"
+#include "states/GameStateManager.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+} // namespace
+
+TEST(ObjectPoolTest, ReleasedSlotsAreReusedAndSlotsNeverOverlap) {
+    ObjectPool pool(40, 4);
+    EXPECT_EQ(pool.getSlotSize() % alignof(std::max_align_t), 0u);
+
+    std::set<std::uintptr_t> addresses;
+    std::vector<void*> slots;
+    for (int i = 0; i < 4; ++i) {
+        slots.push_back(pool.acquire(40));
+        ASSERT_TRUE(pool.owns(slots.back()));
+        addresses.insert(reinterpret_cast<std::uintptr_t>(slots.back()));
+    }
+    EXPECT_EQ(addresses.size(), 4u);
+    EXPECT_EQ(pool.getInUse(), 4u);
+
+    ObjectPool::release(slots[2]);
+    EXPECT_EQ(pool.acquire(24), slots[2]) << "the freed slot comes back first";
+    EXPECT_EQ(pool.getOverflowCount(), 0u);
+}
+
+TEST(ObjectPoolTest, FullPoolAndOversizedRequestsFallBackToTheHeap) {
+    ObjectPool pool(32, 1);
+    void* pooled = pool.acquire(32);
+    void* full = pool.acquire(32);
+    void* oversized = pool.acquire(64);
+    EXPECT_TRUE(pool.owns(pooled));
+    EXPECT_FALSE(pool.owns(full));
+    EXPECT_FALSE(pool.owns(oversized));
+    EXPECT_EQ(pool.getOverflowCount(), 2u);
+
+    ObjectPool::release(full);
+    ObjectPool::release(oversized);
+    ObjectPool::release(pooled);
+    EXPECT_EQ(pool.getInUse(), 0u);
+}
+
+TEST(ObjectPoolTest, BulletsEffectsAndPowerUpsComeFromTheirWorldsPools) {
+    EntityWorld world;
+    EntityWorld other;
+    {
+        auto bullet = world.create<Bullet>(Vector2(10.0f, 10.0f), Direction::Up, nullptr);
+        std::unique_ptr<Effect> explosion = world.create<TankExplosion>(0, 0);
+        std::unique_ptr<Effect> popup = world.create<ScorePopup>(0, 0, 100, 2);
+        auto powerUp = world.create<PowerUp>(0, 0, PowerUpType::Star);
+        EXPECT_TRUE(world.getBulletPool().owns(bullet.get()));
+        EXPECT_TRUE(world.getEffectPool().owns(explosion.get()));
+        EXPECT_TRUE(world.getEffectPool().owns(popup.get()));
+        EXPECT_TRUE(world.getPowerUpPool().owns(powerUp.get()));
+        EXPECT_EQ(world.getEffectPool().getInUse(), 2u);
+        EXPECT_EQ(other.getBulletPool().getInUse(), 0u) << "worlds never share a pool";
+        EXPECT_EQ(other.getEffectPool().getInUse(), 0u);
+    }
+    EXPECT_EQ(world.getBulletPool().getInUse(), 0u);
+    EXPECT_EQ(world.getEffectPool().getInUse(), 0u);
+    EXPECT_EQ(world.getPowerUpPool().getInUse(), 0u);
+}
+
+TEST(ObjectPoolTest, PlainNewOfAPooledClassUsesTheHeap) {
+    EntityWorld world;
+    auto bullet = std::make_unique<Bullet>(world, Vector2(10.0f, 10.0f), Direction::Up, nullptr);
+    EXPECT_FALSE(world.getBulletPool().owns(bullet.get()));
+    EXPECT_EQ(world.getBulletPool().getInUse(), 0u);
+    bullet.reset();
+    EXPECT_EQ(world.getBulletPool().getInUse(), 0u);
+}
+
+TEST(ObjectPoolTest, SustainedFireCausesNoHeapAllocations) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.effects_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->setPosition(Vector2(-100.0f, -100.0f));
+
+    // Every tick a shot flies into a steel wall and leaves an explosion
+    state.setTerrainCell(10, 4, TerrainType::Steel);
+    const auto fire = [&state] {
+        state.addBullet(state.world_.create<Bullet>(Vector2(10 * kCell + 4.0f, 10 * kCell),
+                                                    Direction::Up, nullptr));
+        state.updateEntities(Constants::FIXED_DELTA_TIME);
+        state.checkCollisions();
+        state.removeDeadEntities();
+    };
+
+    for (int i = 0; i < 60; ++i) {
+        fire();
+    }
+    AllocationCounter counter;
+    for (int i = 0; i < 120; ++i) {
+        fire();
+    }
+    EXPECT_EQ(counter.count(), 0);
+    EXPECT_GT(state.effects_.size(), 0u);
+}
+
+} // namespace tank::test
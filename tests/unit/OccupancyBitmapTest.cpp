@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "collision/OccupancyBitmap.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+// Restores the startup kernel when a test forces another one
+class KernelGuard {
+public:
+    KernelGuard() : saved_(OccupancyBitmap::getKernel()) {}
+    ~KernelGuard() { OccupancyBitmap::setKernel(saved_); }
+
+private:
+    OccupancyKernel saved_;
+};
+
+bool bruteForceAny(const OccupancyBitmap& bits, const Rectangle& area) {
+    for (int y = 0; y < bits.getHeight(); ++y) {
+        for (int x = 0; x < bits.getWidth(); ++x) {
+            if (bits.test(x, y) && area.intersects(Rectangle(static_cast<float>(x), static_cast<float>(y), 1.0f, 1.0f))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(OccupancyBitmapTest, FillEraseAndEdgeContact) {
+    OccupancyBitmap bits(442, 442);
+    bits.fill(Rectangle(60.0f, 10.0f, 10.0f, 5.0f));  // Straddles a word boundary
+
+    EXPECT_TRUE(bits.test(60, 10));
+    EXPECT_TRUE(bits.test(69, 14));
+    EXPECT_FALSE(bits.test(70, 14));
+    EXPECT_TRUE(bits.any(Rectangle(65.5f, 14.5f, 1.0f, 1.0f)));
+    // Touching edges do not overlap, as with Rectangle::intersects
+    EXPECT_FALSE(bits.any(Rectangle(70.0f, 10.0f, 8.0f, 8.0f)));
+    EXPECT_FALSE(bits.any(Rectangle(50.0f, 15.0f, 30.0f, 8.0f)));
+
+    bits.erase(Rectangle(60.0f, 10.0f, 5.0f, 5.0f));
+    EXPECT_FALSE(bits.any(Rectangle(60.0f, 10.0f, 5.0f, 5.0f)));
+    EXPECT_TRUE(bits.any(Rectangle(60.0f, 10.0f, 6.0f, 5.0f)));
+
+    // Out-of-range areas are clipped rather than rejected
+    EXPECT_FALSE(bits.any(Rectangle(-100.0f, -100.0f, 50.0f, 50.0f)));
+    bits.fill(Rectangle(430.0f, 430.0f, 40.0f, 40.0f));
+    EXPECT_TRUE(bits.any(Rectangle(441.0f, 441.0f, 10.0f, 10.0f)));
+}
+
+TEST(OccupancyBitmapTest, EveryKernelMatchesBruteForce) {
+    KernelGuard guard;
+    RandomStream random(7);
+
+    OccupancyBitmap bits(442, 442);
+    for (int i = 0; i < 40; ++i) {
+        bits.fill(Rectangle(static_cast<float>(random.nextInt(0, 430)), static_cast<float>(random.nextInt(0, 430)),
+                            static_cast<float>(random.nextInt(1, 17)), static_cast<float>(random.nextInt(1, 17))));
+    }
+
+    std::vector<Rectangle> queries;
+    for (int i = 0; i < 300; ++i) {
+        queries.emplace_back(-20.0f + random.nextFloat() * 460.0f, -20.0f + random.nextFloat() * 460.0f,
+                             0.5f + random.nextFloat() * 300.0f, 0.5f + random.nextFloat() * 40.0f);
+    }
+
+    for (OccupancyKernel kernel : {OccupancyKernel::Scalar, OccupancyKernel::SSE2, OccupancyKernel::AVX2}) {
+        if (!OccupancyBitmap::setKernel(kernel)) {
+            continue;
+        }
+        for (const Rectangle& query : queries) {
+            ASSERT_EQ(bits.any(query), bruteForceAny(bits, query))
+                << OccupancyBitmap::getKernelName(kernel) << " at " << query.x << "," << query.y
+                << " " << query.width << "x" << query.height;
+        }
+    }
+}
+
+TEST(OccupancyBitmapTest, SwitchingKernelsDuringQueriesKeepsResults) {
+    KernelGuard guard;
+    OccupancyBitmap bits(442, 442);
+    bits.fill(Rectangle(200.0f, 200.0f, 16.0f, 16.0f));
+    const Rectangle hit(190.0f, 190.0f, 20.0f, 20.0f);
+    const Rectangle miss(100.0f, 100.0f, 20.0f, 20.0f);
+
+    // A contact worker queries while the main thread flips kernels
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::thread worker([&] {
+        while (!done.load()) {
+            if (!bits.any(hit) || bits.any(miss)) {
+                ++mismatches;
+            }
+        }
+    });
+    for (int i = 0; i < 2000; ++i) {
+        OccupancyBitmap::setKernel(i % 2 ? OccupancyKernel::Scalar : detectSimdLevel());
+    }
+    done = true;
+    worker.join();
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST(OccupancyBitmapTest, DestroyedBrickCornerOnlyClearsItsBits) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+
+    for (int cell = 0; cell < 4; ++cell) {
+        state.setTerrainCell(cell % 2, cell / 2, TerrainType::Brick);
+    }
+    const Rectangle topLeft(0.0f, 0.0f, kCell, kCell);
+    const Rectangle bottomRight(kCell, kCell, kCell, kCell);
+    ASSERT_TRUE(state.tankBlockingBits_.any(topLeft));
+    ASSERT_TRUE(state.bulletBlockingBits_.any(topLeft));
+
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(4.0f, 4.0f), Direction::Up, nullptr, 0));
+    state.checkCollisions();
+
+    EXPECT_FALSE(state.tankBlockingBits_.any(topLeft));
+    EXPECT_FALSE(state.bulletBlockingBits_.any(topLeft));
+    EXPECT_TRUE(state.tankBlockingBits_.any(bottomRight));
+    EXPECT_TRUE(state.isTerrainBlockingTank(Rectangle(0.0f, 0.0f, 2 * kCell, 2 * kCell)));
+}
+
+TEST(OccupancyBitmapTest, WaterBlocksTanksButNotBullets) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.clearTerrain();
+
+    state.setTerrainCell(5, 5, TerrainType::Water);
+    const Rectangle cell(5 * kCell, 5 * kCell, kCell, kCell);
+    EXPECT_TRUE(state.tankBlockingBits_.any(cell));
+    EXPECT_FALSE(state.bulletBlockingBits_.any(cell));
+}
+
+} // namespace tank::test
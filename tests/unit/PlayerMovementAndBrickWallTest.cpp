@@ -6,7 +6,7 @@
 #undef private
 #undef protected
 
-#include "entities/terrain/BrickWall.hpp"
+#include "entities/terrain/TerrainMap.hpp"
 #include "mocks/ScriptedInput.hpp"
 #include "states/GameStateManager.hpp"
 
@@ -23,7 +23,7 @@ TEST(PlayerMovementAndBrickWallTest, Player1MovesUpWhenHoldingW) {
     const Vector2 before = state.player1_->getPosition();
 
     ScriptedInput input;
-    input.setKeyDown(SDL_SCANCODE_W, true);
+    input.setKeyDown(Scancode::W, true);
     state.handleInput(input);
     state.update(0.016f);
 
@@ -32,12 +32,11 @@ TEST(PlayerMovementAndBrickWallTest, Player1MovesUpWhenHoldingW) {
 }
 
 TEST(PlayerMovementAndBrickWallTest, BrickWallCornersSplitEvenly) {
-    BrickWall brick(Vector2(0.0f, 0.0f));
-
-    const Rectangle tl = brick.getCornerBounds(0);
-    const Rectangle tr = brick.getCornerBounds(1);
-    const Rectangle bl = brick.getCornerBounds(2);
-    const Rectangle br = brick.getCornerBounds(3);
+    // A brick corner is one map cell; the four cells of a tile are equal
+    const Rectangle tl = TerrainMap::getCellBounds({0, 0});
+    const Rectangle tr = TerrainMap::getCellBounds({1, 0});
+    const Rectangle bl = TerrainMap::getCellBounds({0, 1});
+    const Rectangle br = TerrainMap::getCellBounds({1, 1});
 
     EXPECT_FLOAT_EQ(tl.width, tr.width);
     EXPECT_FLOAT_EQ(tl.width, bl.width);
@@ -49,6 +48,8 @@ TEST(PlayerMovementAndBrickWallTest, BrickWallCornersSplitEvenly) {
 
     EXPECT_FLOAT_EQ(tl.width + tr.width, static_cast<float>(Constants::ELEMENT_SIZE));
     EXPECT_FLOAT_EQ(tl.height + bl.height, static_cast<float>(Constants::ELEMENT_SIZE));
+    EXPECT_FLOAT_EQ(tr.x, tl.x + tl.width);
+    EXPECT_FLOAT_EQ(bl.y, tl.y + tl.height);
 }
 
 } // namespace tank::test
@@ -20,7 +20,7 @@ TEST(PlayerTankUpgradeTest, CollectStarUpgradesPlayerTankLevel) {
 
     state.enemies_.clear();
     state.bullets_.clear();
-    state.terrains_.clear();
+    state.clearTerrain();
     state.base_.reset();
     state.effects_.clear();
     state.powerUpManager_.clear();
@@ -19,11 +19,11 @@ TEST(PlayingStateEffectsTest, BulletHitSpawnsBulletExplosion) {
     state.effects_.clear();
     state.bullets_.clear();
     state.enemies_.clear();
-    state.terrains_.clear();
+    state.clearTerrain();
     state.base_.reset();
 
-    state.terrains_.push_back(std::make_unique<BrickWall>(Vector2(0.0f, 0.0f)));
-    state.bullets_.push_back(std::make_unique<Bullet>(Vector2(0.0f, 0.0f), Direction::Up, nullptr, 0));
+    state.setTerrainCell(0, 0, TerrainType::Brick);
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(0.0f, 0.0f), Direction::Up, nullptr, 0));
 
     state.checkCollisions();
 
@@ -46,14 +46,14 @@ TEST(PlayingStateEffectsTest, TankDeathSpawnsTankExplosion) {
     state.effects_.clear();
     state.bullets_.clear();
     state.enemies_.clear();
-    state.terrains_.clear();
+    state.clearTerrain();
     state.base_.reset();
 
-    auto enemy = std::make_unique<EnemyTank>(Vector2(100.0f, 100.0f), EnemyType::Basic);
+    auto enemy = std::make_unique<EnemyTank>(state.world_, Vector2(100.0f, 100.0f), EnemyType::Basic);
     state.enemies_.push_back(std::move(enemy));
 
     ASSERT_NE(state.player1_, nullptr);
-    state.bullets_.push_back(std::make_unique<Bullet>(Vector2(100.0f, 100.0f), Direction::Up, state.player1_.get(), 0));
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(100.0f, 100.0f), Direction::Up, state.player1_.get(), 0));
 
     state.checkCollisions();
 
@@ -13,7 +13,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(PlayingState& state, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(PlayingState& state, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     state.handleInput(input);
     input.advanceFrame();
@@ -30,18 +30,18 @@ TEST(PlayingStateMenuTest, PauseMenuContinueThenRestart) {
 
     EXPECT_FALSE(state.isPaused());
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_TRUE(state.isPaused());
 
     // Default selection is CONTINUE
-    pressKeyOnce(state, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(state, input, Scancode::Return);
     EXPECT_FALSE(state.isPaused());
 
     // Pause again and choose RESTART
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_TRUE(state.isPaused());
-    pressKeyOnce(state, input, SDL_SCANCODE_DOWN);
-    pressKeyOnce(state, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(state, input, Scancode::Down);
+    pressKeyOnce(state, input, Scancode::Return);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -53,10 +53,10 @@ TEST(PlayingStateMenuTest, PauseMenuEscapeResumesGame) {
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
     ScriptedInput input;
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_TRUE(state.isPaused());
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_FALSE(state.isPaused());
 }
 
@@ -65,10 +65,10 @@ TEST(PlayingStateMenuTest, PauseMenuRRestartsLevel) {
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
     ScriptedInput input;
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_TRUE(state.isPaused());
 
-    pressKeyOnce(state, input, SDL_SCANCODE_R);
+    pressKeyOnce(state, input, Scancode::R);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -84,10 +84,10 @@ TEST(PlayingStateMenuTest, PauseMenuMReturnsToMainMenu) {
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
     ScriptedInput input;
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_TRUE(state.isPaused());
 
-    pressKeyOnce(state, input, SDL_SCANCODE_M);
+    pressKeyOnce(state, input, Scancode::M);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -99,13 +99,13 @@ TEST(PlayingStateMenuTest, PauseMenuReturnToMainMenu) {
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
     ScriptedInput input;
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
     EXPECT_TRUE(state.isPaused());
 
     // CONTINUE -> RESTART -> MAIN MENU
-    pressKeyOnce(state, input, SDL_SCANCODE_DOWN);
-    pressKeyOnce(state, input, SDL_SCANCODE_DOWN);
-    pressKeyOnce(state, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(state, input, Scancode::Down);
+    pressKeyOnce(state, input, Scancode::Down);
+    pressKeyOnce(state, input, Scancode::Return);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -120,7 +120,7 @@ TEST(PlayingStateMenuTest, GameOverEscapeReturnsToMenu) {
     state.gameOver_ = true;
     state.gameOverOverlay_.start();
 
-    pressKeyOnce(state, input, SDL_SCANCODE_ESCAPE);
+    pressKeyOnce(state, input, Scancode::Escape);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -135,7 +135,7 @@ TEST(PlayingStateMenuTest, GameOverEnterRestartsLevel) {
     state.gameOver_ = true;
     state.gameOverOverlay_.start();
 
-    pressKeyOnce(state, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(state, input, Scancode::Return);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -154,8 +154,8 @@ TEST(PlayingStateMenuTest, GameOverSelectMainMenuThenSpaceReturnsToMenu) {
     state.gameOver_ = true;
     state.gameOverOverlay_.start();
 
-    pressKeyOnce(state, input, SDL_SCANCODE_DOWN);
-    pressKeyOnce(state, input, SDL_SCANCODE_SPACE);
+    pressKeyOnce(state, input, Scancode::Down);
+    pressKeyOnce(state, input, Scancode::Space);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -170,7 +170,7 @@ TEST(PlayingStateMenuTest, GameOverRRestartsLevel) {
     state.gameOver_ = true;
     state.gameOverOverlay_.start();
 
-    pressKeyOnce(state, input, SDL_SCANCODE_R);
+    pressKeyOnce(state, input, Scancode::R);
 
     manager.update(0.0f);
     ASSERT_NE(manager.getCurrentState(), nullptr);
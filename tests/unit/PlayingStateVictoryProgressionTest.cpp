@@ -13,7 +13,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -28,8 +28,8 @@ TEST(PlayingStateVictoryProgressionTest, VictoryShowsScoreThenNextStageAndPreser
     PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/true);
 
     state.level_ = std::make_unique<Level>(1);
-    state.player1_ = std::make_unique<PlayerTank>(1, Vector2(0.0f, 0.0f));
-    state.player2_ = std::make_unique<PlayerTank>(2, Vector2(34.0f, 0.0f));
+    state.player1_ = std::make_unique<PlayerTank>(state.world_, 1, Vector2(0.0f, 0.0f));
+    state.player2_ = std::make_unique<PlayerTank>(state.world_, 2, Vector2(34.0f, 0.0f));
     state.enemiesAlive_ = 0;
     state.enemiesSpawned_ = 0;
     state.levelComplete_ = false;
@@ -42,8 +42,8 @@ TEST(PlayingStateVictoryProgressionTest, VictoryShowsScoreThenNextStageAndPreser
 
     // Skip tally animation, then continue -> StageState for the next level.
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(manager, input, Scancode::Return);
+    pressKeyOnce(manager, input, Scancode::Return);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
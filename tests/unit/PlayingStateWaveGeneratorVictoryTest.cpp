@@ -13,7 +13,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -54,8 +54,8 @@ TEST(PlayingStateWaveGeneratorVictoryTest, WaveGeneratorEnabled_VictoryTransitio
 
     // Skip tally animation, then continue -> StageState for the next level.
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);
+    pressKeyOnce(manager, input, Scancode::Return);
+    pressKeyOnce(manager, input, Scancode::Return);
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -9,6 +9,9 @@
 #include "ai/AIBehavior.hpp"
 #include "states/GameStateManager.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace tank::test {
 
 class PowerUpEffectsTest : public ::testing::Test {
@@ -25,6 +28,22 @@ protected:
         state_.effects_.clear();
         state_.enemiesAlive_ = 0;
     }
+
+    // Top-left cell of the first whole 2x2 brick block, in reading order
+    bool findBrickBlock(int& cellX, int& cellY) const {
+        const TerrainMap& map = state_.terrainMap_;
+        for (int y = 0; y + 1 < map.getHeight(); y += 2) {
+            for (int x = 0; x + 1 < map.getWidth(); x += 2) {
+                if (map.get(x, y) == TerrainType::Brick && map.get(x + 1, y) == TerrainType::Brick &&
+                    map.get(x, y + 1) == TerrainType::Brick && map.get(x + 1, y + 1) == TerrainType::Brick) {
+                    cellX = x;
+                    cellY = y;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
 };
 
 TEST_F(PowerUpEffectsTest, GunImmediatelySetsMaximumTankLevel) {
@@ -44,7 +63,7 @@ TEST_F(PowerUpEffectsTest, IronCapAndTankApplyPlayerScopedEffects) {
 }
 
 TEST_F(PowerUpEffectsTest, StopWatchFreezesEnemyUpdates) {
-    auto enemy = std::make_unique<EnemyTank>(Vector2(100.0f, 100.0f), EnemyType::Basic);
+    auto enemy = std::make_unique<EnemyTank>(state_.world_, Vector2(100.0f, 100.0f), EnemyType::Basic);
     enemy->setAIBehavior(std::make_unique<SimpleAI>());
     EnemyTank* enemyPtr = enemy.get();
     state_.enemies_.push_back(std::move(enemy));
@@ -61,7 +80,7 @@ TEST_F(PowerUpEffectsTest, StopWatchFreezesEnemyUpdates) {
 
 TEST_F(PowerUpEffectsTest, BombClearsEnemiesWithoutPowerUpChainDrops) {
     for (int i = 0; i < 2; ++i) {
-        auto enemy = std::make_unique<EnemyTank>(Vector2(80.0f + i * 50.0f, 100.0f), EnemyType::Basic);
+        auto enemy = std::make_unique<EnemyTank>(state_.world_, Vector2(80.0f + i * 50.0f, 100.0f), EnemyType::Basic);
         enemy->setCarriesPowerUp(true);
         state_.enemies_.push_back(std::move(enemy));
     }
@@ -117,23 +136,15 @@ TEST_F(PowerUpEffectsTest, SpadeFortifiesAndRestoresBasePerimeter) {
 }
 
 TEST_F(PowerUpEffectsTest, SpadeDoesNotResurrectDestroyedBricks) {
-    // Find a brick wall away from the base and destroy two of its corners.
-    BrickWall* target = nullptr;
-    for (const auto& terrain : state_.terrains_) {
-        if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-            target = brick;
-            break;
-        }
-    }
-    ASSERT_NE(target, nullptr);
-
-    const int cellX = static_cast<int>(target->getPosition().x) / Constants::CELL_SIZE;
-    const int cellY = static_cast<int>(target->getPosition().y) / Constants::CELL_SIZE;
-    target->cornerStates_[0] = false;  // TL destroyed
-    target->cornerStates_[1] = false;  // TR destroyed
-
-    // Fortifying rebuilds all terrain entities from the level map; the map
-    // must first absorb the live entity state, or destroyed corners return.
+    // Find a brick block away from the base and destroy its top two cells.
+    int cellX = 0;
+    int cellY = 0;
+    ASSERT_TRUE(findBrickBlock(cellX, cellY));
+    state_.setTerrainCell(cellX, cellY, TerrainType::Empty);
+    state_.setTerrainCell(cellX + 1, cellY, TerrainType::Empty);
+
+    // Fortifying rebuilds the terrain from the level map; the level must
+    // first absorb the live map, or destroyed cells return.
     state_.applyPowerUp(*state_.player1_, PowerUpType::Spade);
 
     EXPECT_EQ(state_.level_->getTerrainAt(cellX, cellY), TerrainType::Empty);
@@ -144,20 +155,15 @@ TEST_F(PowerUpEffectsTest, SpadeDoesNotResurrectDestroyedBricks) {
 }
 
 TEST_F(PowerUpEffectsTest, SpadeDoesNotResurrectFullyClearedBrickBlocks) {
-    // Destroy a whole 2x2 brick block; removeDeadEntities erases the entity.
-    BrickWall* target = nullptr;
-    for (const auto& terrain : state_.terrains_) {
-        if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-            target = brick;
-            break;
+    // Destroy a whole 2x2 brick block.
+    int cellX = 0;
+    int cellY = 0;
+    ASSERT_TRUE(findBrickBlock(cellX, cellY));
+    for (int dy = 0; dy < 2; ++dy) {
+        for (int dx = 0; dx < 2; ++dx) {
+            state_.setTerrainCell(cellX + dx, cellY + dy, TerrainType::Empty);
         }
     }
-    ASSERT_NE(target, nullptr);
-
-    const int cellX = static_cast<int>(target->getPosition().x) / Constants::CELL_SIZE;
-    const int cellY = static_cast<int>(target->getPosition().y) / Constants::CELL_SIZE;
-    target->cornerStates_.fill(false);
-    state_.removeDeadEntities();
 
     state_.applyPowerUp(*state_.player1_, PowerUpType::Spade);
 
@@ -169,9 +175,39 @@ TEST_F(PowerUpEffectsTest, SpadeDoesNotResurrectFullyClearedBrickBlocks) {
     }
 }
 
+TEST_F(PowerUpEffectsTest, SpadeRewritesOnlyThePerimeterCells) {
+    // A shot-away brick reaches the level's map at once
+    int cellX = 0;
+    int cellY = 0;
+    ASSERT_TRUE(findBrickBlock(cellX, cellY));
+    state_.setTerrainCell(cellX, cellY, TerrainType::Empty);
+    EXPECT_EQ(state_.level_->getTerrainAt(cellX, cellY), TerrainType::Empty);
+
+    const std::vector<TerrainType> before = state_.terrainMap_.getCells();
+    const Base* base = state_.base_.get();
+    state_.applyPowerUp(*state_.player1_, PowerUpType::Spade);
+
+    // No rebuild: the base entity survives and only the wall cells change
+    EXPECT_EQ(state_.base_.get(), base);
+    const TerrainMap& map = state_.terrainMap_;
+    for (int y = 0; y < map.getHeight(); ++y) {
+        for (int x = 0; x < map.getWidth(); ++x) {
+            const bool fortified = std::any_of(state_.fortifiedCells_.begin(), state_.fortifiedCells_.end(),
+                                               [x, y](const auto& cell) { return cell.x == x && cell.y == y; });
+            if (!fortified) {
+                EXPECT_EQ(map.get(x, y), before[static_cast<size_t>(y * map.getWidth() + x)])
+                    << "cell (" << x << "," << y << ")";
+            }
+            if (state_.level_->getTerrainAt(x, y) != TerrainType::Base) {
+                EXPECT_EQ(state_.level_->getTerrainAt(x, y), map.get(x, y)) << "cell (" << x << "," << y << ")";
+            }
+        }
+    }
+}
+
 TEST_F(PowerUpEffectsTest, UnfrozenEnemyMovesAndFires) {
     // Control case: without StopWatch the same enemy setup must act.
-    auto enemy = std::make_unique<EnemyTank>(Vector2(100.0f, 100.0f), EnemyType::Basic);
+    auto enemy = std::make_unique<EnemyTank>(state_.world_, Vector2(100.0f, 100.0f), EnemyType::Basic);
     enemy->setAIBehavior(std::make_unique<SimpleAI>());
     EnemyTank* enemyPtr = enemy.get();
     state_.enemies_.push_back(std::move(enemy));
@@ -186,7 +222,7 @@ TEST_F(PowerUpEffectsTest, UnfrozenEnemyMovesAndFires) {
 }
 
 TEST_F(PowerUpEffectsTest, StopWatchAlsoStopsEnemyFire) {
-    auto enemy = std::make_unique<EnemyTank>(Vector2(100.0f, 100.0f), EnemyType::Basic);
+    auto enemy = std::make_unique<EnemyTank>(state_.world_, Vector2(100.0f, 100.0f), EnemyType::Basic);
     enemy->setAIBehavior(std::make_unique<SimpleAI>());
     state_.enemies_.push_back(std::move(enemy));
     state_.enemiesAlive_ = 1;
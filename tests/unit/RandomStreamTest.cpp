@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "utils/Random.hpp"
+
+#include <array>
+#include <set>
+
+namespace tank::test {
+
+TEST(RandomStreamTest, StreamIsSmall) {
+    EXPECT_EQ(sizeof(RandomStream), 16u);
+}
+
+TEST(RandomStreamTest, SameSeedSameSequence) {
+    WorldRandom a(1234);
+    WorldRandom b(1234);
+    RandomStream streamA = a.createStream();
+    RandomStream streamB = b.createStream();
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(streamA(), streamB());
+        ASSERT_EQ(a.world()(), b.world()());
+    }
+}
+
+TEST(RandomStreamTest, StreamsAreIndependent) {
+    WorldRandom world(99);
+    RandomStream first = world.createStream();
+    RandomStream second = world.createStream();
+    EXPECT_NE(first.getKey(), second.getKey());
+
+    // Drawing from one stream must not disturb another.
+    RandomStream secondCopy = second;
+    for (int i = 0; i < 10; ++i) {
+        first();
+    }
+    EXPECT_EQ(second(), secondCopy());
+}
+
+TEST(RandomStreamTest, ReseedRestartsStreamSequence) {
+    WorldRandom world(5);
+    const uint64_t firstKey = world.createStream().getKey();
+    world.createStream();
+
+    world.reseed(5);
+    EXPECT_EQ(world.createStream().getKey(), firstKey);
+}
+
+TEST(RandomStreamTest, NextIntStaysInRangeAndCoversIt) {
+    RandomStream stream(42);
+    std::set<int> seen;
+    for (int i = 0; i < 2000; ++i) {
+        const int value = stream.nextInt(-2, 3);
+        ASSERT_GE(value, -2);
+        ASSERT_LE(value, 3);
+        seen.insert(value);
+    }
+    EXPECT_EQ(seen.size(), 6u);
+    EXPECT_EQ(stream.nextInt(7, 7), 7);
+}
+
+TEST(RandomStreamTest, NextFloatIsInUnitInterval) {
+    RandomStream stream(7);
+    for (int i = 0; i < 1000; ++i) {
+        const float value = stream.nextFloat();
+        ASSERT_GE(value, 0.0f);
+        ASSERT_LT(value, 1.0f);
+    }
+}
+
+TEST(RandomStreamTest, WeightedPickFollowsWeights) {
+    constexpr int weights[] = {60, 0, 30, 10};
+    RandomStream stream(2024);
+    std::array<int, 4> counts{};
+    constexpr int DRAWS = 20000;
+    for (int i = 0; i < DRAWS; ++i) {
+        ++counts[stream.nextWeighted(weights)];
+    }
+
+    EXPECT_EQ(counts[1], 0);
+    EXPECT_NEAR(counts[0] / static_cast<double>(DRAWS), 0.6, 0.02);
+    EXPECT_NEAR(counts[2] / static_cast<double>(DRAWS), 0.3, 0.02);
+    EXPECT_NEAR(counts[3] / static_cast<double>(DRAWS), 0.1, 0.02);
+}
+
+} // namespace tank::test
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include "rendering/RecordingRenderer.hpp"
+#include "rendering/RenderCommandList.hpp"
+#include "rendering/RenderThread.hpp"
+#include "mocks/MockRenderer.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+// Backend that hands out its own texture ids and logs texture/text draws
+class TextureLoggingRenderer : public MockRenderer {
+public:
+    TextureHandle loadTexture(const std::string& path) override {
+        loadedPaths.push_back(path);
+        return TextureHandle{static_cast<uint32_t>(100 + loadedPaths.size())};
+    }
+    void drawTexture(TextureHandle texture, const Rectangle&) override {
+        drawnTextures.push_back(texture.id);
+    }
+    void drawText(const std::string& text, const Vector2&, const Constants::Color&, int) override {
+        texts.push_back(text);
+    }
+
+    std::vector<std::string> loadedPaths;
+    std::vector<uint32_t> drawnTextures;
+    std::vector<std::string> texts;
+};
+
+} // namespace
+
+TEST(RenderCommandListTest, ReplayIssuesRecordedCallsInOrder) {
+    RenderCommandList list;
+    list.clearScreen(1, 2, 3, 255);
+    list.fillRect(10, 20, 30, 40, 255, 0, 0, 128);
+    list.drawSprite(0, 0, 16, 16, 5, 6, 34, 34);
+    list.drawText("STAGE 1", Vector2(8.0f, 9.0f), Constants::Color(255, 255, 255), 12);
+    ASSERT_EQ(list.size(), 4u);
+
+    TextureLoggingRenderer target;
+    RenderCommandList::TextureTable textures;
+    list.replay(target, textures);
+
+    ASSERT_EQ(target.getRectCalls().size(), 1u);
+    EXPECT_EQ(target.getRectCalls()[0].w, 30);
+    EXPECT_EQ(target.getRectCalls()[0].a, 128);
+    EXPECT_EQ(target.getDrawCallCount(), 1);
+    EXPECT_EQ(target.getLastDrawCall().destX, 5);
+    EXPECT_EQ(target.getLastDrawCall().destW, 34);
+    ASSERT_EQ(target.texts.size(), 1u);
+    EXPECT_EQ(target.texts[0], "STAGE 1");
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(RenderCommandListTest, RecorderHandlesMapToBackendTexturesOnReplay) {
+    TextureLoggingRenderer backend;
+    std::vector<RenderCommandList> submitted;
+    RecordingRenderer recorder(backend, [&submitted](RenderCommandList& frame) {
+        submitted.push_back(frame);
+    });
+
+    const TextureHandle logo = recorder.loadTexture("assets/images/logo.png");
+    EXPECT_TRUE(logo);
+    EXPECT_EQ(recorder.loadTexture("assets/images/logo.png"), logo) << "paths are cached";
+    EXPECT_TRUE(backend.loadedPaths.empty()) << "loading is deferred to replay";
+
+    recorder.drawTexture(logo, Rectangle(0.0f, 0.0f, 10.0f, 10.0f));
+    recorder.present();
+    ASSERT_EQ(submitted.size(), 1u);
+    EXPECT_TRUE(recorder.getFrame().empty());
+
+    RenderCommandList::TextureTable textures;
+    submitted[0].replay(backend, textures);
+    ASSERT_EQ(backend.loadedPaths.size(), 1u);
+    ASSERT_EQ(backend.drawnTextures.size(), 1u);
+    EXPECT_EQ(backend.drawnTextures[0], 101u);
+
+    // Later frames keep using the mapping established by the first replay
+    recorder.drawTexture(logo, Rectangle(0.0f, 0.0f, 10.0f, 10.0f));
+    recorder.present();
+    submitted[1].replay(backend, textures);
+    EXPECT_EQ(backend.loadedPaths.size(), 1u);
+    EXPECT_EQ(backend.drawnTextures.back(), 101u);
+}
+
+TEST(RenderCommandListTest, RecorderForwardsQueriesToBackend) {
+    MockRenderer backend;
+    RecordingRenderer recorder(backend, {});
+    EXPECT_EQ(recorder.getWidth(), backend.getWidth());
+    EXPECT_EQ(recorder.measureText("ABC", 14).y, 14.0f);
+}
+
+TEST(RenderThreadTest, PresentsEverySubmittedFrameOnItsOwnThread) {
+    MockRenderer backend;
+    RenderThread renderThread(backend);
+
+    std::thread::id renderThreadId;
+    bool tornDown = false;
+    ASSERT_TRUE(renderThread.start(
+        [&renderThreadId]() { renderThreadId = std::this_thread::get_id(); return true; },
+        [&tornDown]() { tornDown = true; }));
+    EXPECT_NE(renderThreadId, std::this_thread::get_id());
+
+    RenderCommandList frame;
+    for (int i = 0; i < 5; ++i) {
+        frame.drawSprite(0, 0, 1, 1, i, i, 1, 1);
+        renderThread.submit(frame);
+        EXPECT_TRUE(frame.empty()) << "submit returns a recycled, empty list";
+    }
+    renderThread.waitIdle();
+
+    EXPECT_EQ(renderThread.getFramesPresented(), 5u);
+    EXPECT_EQ(backend.getDrawCallCount(), 5);
+    EXPECT_EQ(backend.getLastDrawCall().destX, 4);
+
+    renderThread.stop();
+    EXPECT_TRUE(tornDown);
+    EXPECT_FALSE(renderThread.isRunning());
+}
+
+TEST(RenderThreadTest, FailedSetUpReportsFailure) {
+    MockRenderer backend;
+    RenderThread renderThread(backend);
+    EXPECT_FALSE(renderThread.start([]() { return false; }));
+    EXPECT_FALSE(renderThread.isRunning());
+}
+
+} // namespace tank::test
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "states/GameStateManager.hpp"
+#include "entities/projectiles/Bullet.hpp"
+#include "entities/tanks/PlayerTank.hpp"
+#include "graphics/SpriteSheet.hpp"
+#include "mocks/MockRenderer.hpp"
+
+namespace tank {
+namespace test {
+
+TEST(RenderInterpolationTest, TankRendersBetweenTickStartAndCurrentPosition) {
+    EntityWorld world;
+    PlayerTank tank(world, 1, Vector2(100.0f, 100.0f));
+    tank.update(1.0f);  // finish spawn animation
+
+    tank.snapshotTransform();
+    tank.move(Direction::Right);
+    ASSERT_FLOAT_EQ(tank.getPosition().x, 100.0f + Constants::PLAYER_DEFAULT_SPEED);
+
+    tank.setRenderAlpha(0.0f);
+    EXPECT_FLOAT_EQ(tank.getRenderPosition().x, 100.0f);
+    tank.setRenderAlpha(0.5f);
+    EXPECT_FLOAT_EQ(tank.getRenderPosition().x, 100.0f + Constants::PLAYER_DEFAULT_SPEED * 0.5f);
+    tank.setRenderAlpha(1.0f);
+    EXPECT_EQ(tank.getRenderPosition(), tank.getPosition());
+
+    MockRenderer renderer;
+    tank.invincibleTimer_ = 0.0f;  // no spawn-shield blink
+    tank.setRenderAlpha(0.0f);
+    tank.render(renderer);
+    ASSERT_GT(renderer.getDrawCallCount(), 0);
+    const int margin = (Sprites::ELEMENT_SIZE - Constants::TANK_COLLISION_SIZE) / 2;
+    EXPECT_EQ(renderer.getLastDrawCall().destX, 100 - margin);
+}
+
+TEST(RenderInterpolationTest, SpawnAndTeleportSnapInsteadOfSliding) {
+    EntityWorld world;
+    PlayerTank tank(world, 1, Vector2(100.0f, 100.0f));
+    tank.snapshotTransform();
+    tank.spawn(Vector2(300.0f, 400.0f));
+    tank.setRenderAlpha(0.25f);
+    EXPECT_EQ(tank.getRenderPosition(), Vector2(300.0f, 400.0f));
+
+    tank.snapshotTransform();
+    tank.setPosition(Vector2(10.0f, 10.0f));
+    EXPECT_EQ(tank.getRenderPosition(), Vector2(10.0f, 10.0f));
+}
+
+TEST(RenderInterpolationTest, PlayingStateAppliesAlphaToBullets) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
+    state.level_ = std::make_unique<Level>(1);
+    state.bullets_.clear();
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(200.0f, 200.0f), Direction::Up, nullptr, 0));
+    Bullet& bullet = *state.bullets_.back();
+
+    state.snapshotTransforms();
+    bullet.update(Constants::FIXED_DELTA_TIME);
+    const float travelled = 200.0f - bullet.getPosition().y;
+    ASSERT_GT(travelled, 0.0f);
+
+    MockRenderer renderer;
+    state.renderInterpolated(renderer, 0.5f);
+    EXPECT_FLOAT_EQ(bullet.getRenderPosition().y, 200.0f - travelled * 0.5f);
+
+    state.render(renderer);
+    EXPECT_EQ(bullet.getRenderPosition(), bullet.getPosition());
+}
+
+TEST(RenderInterpolationTest, PausedWorldIsNotDrawnMidBlend) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false);
+    state.level_ = std::make_unique<Level>(1);
+    state.player1_ = std::make_unique<PlayerTank>(state.world_, 1, Vector2(100.0f, 100.0f));
+    state.player1_->update(1.0f);
+
+    state.player1_->snapshotTransform();
+    state.player1_->move(Direction::Down);
+    state.paused_ = true;
+    state.update(Constants::FIXED_DELTA_TIME);
+
+    state.setRenderAlpha(0.3f);
+    EXPECT_EQ(state.player1_->getRenderPosition(), state.player1_->getPosition());
+}
+
+}  // namespace test
+}  // namespace tank
@@ -13,7 +13,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -39,14 +39,14 @@ TEST(ScoreStateTest, SkipAnimationThenContinueGoesToNextStageOnVictory) {
     EXPECT_FALSE(scoreState->animationComplete_);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);  // Skip animation.
+    pressKeyOnce(manager, input, Scancode::Return);  // Skip animation.
 
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Score);
     EXPECT_TRUE(scoreState->animationComplete_);
     EXPECT_EQ(scoreState->displayedKills_[0], 1);
     EXPECT_EQ(scoreState->displayedTotal_, 1);
 
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);  // Continue.
+    pressKeyOnce(manager, input, Scancode::Return);  // Continue.
     manager.update(0.0f);                               // Apply pending change.
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -69,8 +69,8 @@ TEST(ScoreStateTest, SkipAnimationThenContinueReturnsToMenuOnDefeat) {
     ASSERT_EQ(manager.getCurrentState()->getType(), StateType::Score);
 
     ScriptedInput input;
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);  // Skip animation.
-    pressKeyOnce(manager, input, SDL_SCANCODE_RETURN);  // Continue.
+    pressKeyOnce(manager, input, Scancode::Return);  // Skip animation.
+    pressKeyOnce(manager, input, Scancode::Return);  // Continue.
     manager.update(0.0f);
 
     ASSERT_NE(manager.getCurrentState(), nullptr);
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "core/Clock.hpp"
+#include "core/FramePacer.hpp"
+#include "core/SimulationTimer.hpp"
+#include <memory>
+
+namespace tank::test {
+namespace {
+
+int runTicks(SimulationTimer& timer) {
+    int ticks = 0;
+    while (timer.hasTick()) {
+        timer.consumeTick();
+        ++ticks;
+    }
+    return ticks;
+}
+
+constexpr double kStep = 1.0 / 60.0;
+
+} // namespace
+
+TEST(SimulationTimerTest, RealTimeRunsOneTickPerSixtiethOfASecond) {
+    SimulationTimer timer(kStep);
+    int ticks = 0;
+    for (int frame = 0; frame < 120; ++frame) {
+        timer.advance(1.0 / 120.0);
+        ticks += runTicks(timer);
+    }
+    EXPECT_NEAR(ticks, 60, 1);
+}
+
+TEST(SimulationTimerTest, FastForwardRunsSeveralTicksPerFrame) {
+    SimulationTimer timer(kStep);
+    timer.setTimeScale(16.0);
+    timer.advance(kStep);
+    EXPECT_EQ(runTicks(timer), 16);
+
+    timer.setTimeScale(2.0);
+    timer.advance(kStep);
+    EXPECT_EQ(runTicks(timer), 2);
+}
+
+TEST(SimulationTimerTest, SlowMotionSpreadsTicksAndInterpolates) {
+    SimulationTimer timer(kStep);
+    timer.setTimeScale(0.25);
+    timer.advance(kStep);
+    EXPECT_EQ(runTicks(timer), 0);
+    EXPECT_NEAR(timer.getAlpha(), 0.25f, 1e-4f);
+    EXPECT_NEAR(timer.getRealSecondsUntilNextTick(), 3.0 * kStep, 1e-9);
+
+    timer.advance(3.0 * kStep);
+    EXPECT_EQ(runTicks(timer), 1);
+}
+
+TEST(SimulationTimerTest, HitchesAreClampedAtEveryScale) {
+    SimulationTimer timer(kStep);
+    timer.advance(5.0);
+    EXPECT_EQ(runTicks(timer), static_cast<int>(SimulationTimer::MAX_FRAME_TIME / kStep + 1e-6));
+
+    timer.setTimeScale(16.0);
+    timer.advance(5.0);
+    EXPECT_EQ(runTicks(timer), static_cast<int>(SimulationTimer::MAX_FRAME_TIME * 16.0 / kStep + 1e-6));
+}
+
+TEST(SimulationTimerTest, EffectiveScaleShowsTimeLostToSlowTicks) {
+    SimulationTimer timer(kStep);
+    timer.setTimeScale(16.0);
+    // Each frame's ticks "cost" 0.5 s of real time, beyond the clamp
+    for (int frame = 0; frame < 6; ++frame) {
+        timer.advance(0.5);
+        runTicks(timer);
+    }
+    EXPECT_LT(timer.getEffectiveScale(), 16.0);
+    EXPECT_NEAR(timer.getEffectiveScale(), 8.0, 0.5);
+}
+
+TEST(SimulationTimerTest, ScaleIsClampedAndHotkeysCycle) {
+    SimulationTimer timer;
+    timer.setTimeScale(100.0);
+    EXPECT_DOUBLE_EQ(timer.getTimeScale(), SimulationTimer::MAX_TIME_SCALE);
+    timer.setTimeScale(0.0);
+    EXPECT_DOUBLE_EQ(timer.getTimeScale(), SimulationTimer::MIN_TIME_SCALE);
+
+    EXPECT_DOUBLE_EQ(SimulationTimer::nextTurboScale(1.0), 2.0);
+    EXPECT_DOUBLE_EQ(SimulationTimer::nextTurboScale(2.0), 4.0);
+    EXPECT_DOUBLE_EQ(SimulationTimer::nextTurboScale(4.0), 16.0);
+    EXPECT_DOUBLE_EQ(SimulationTimer::nextTurboScale(16.0), 1.0);
+    EXPECT_DOUBLE_EQ(SimulationTimer::toggleSlowMotion(1.0), 0.25);
+    EXPECT_DOUBLE_EQ(SimulationTimer::toggleSlowMotion(0.25), 1.0);
+}
+
+TEST(SimulationTimerTest, FramePacerWaitsOnTheInjectedClock) {
+    auto clock = std::make_shared<ManualClock>(10.0);
+    FramePacer pacer(PacingMode::Limiter, 50.0, clock);
+
+    pacer.waitForNextFrame();
+    EXPECT_DOUBLE_EQ(clock->now(), 10.02);
+
+    clock->advance(0.005);  // A frame's work
+    pacer.waitForNextFrame();
+    EXPECT_NEAR(clock->now(), 10.04, 1e-9) << "deadlines advance by whole periods";
+
+    pacer.markInputSampled();
+    clock->advance(0.007);
+    pacer.markPresented();
+    EXPECT_NEAR(pacer.getInputLatency().getLatest(), 0.007, 1e-9);
+}
+
+} // namespace tank::test
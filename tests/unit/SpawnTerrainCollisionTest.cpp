@@ -8,7 +8,6 @@
 
 #include "states/GameStateManager.hpp"
 #include "states/MenuState.hpp"
-#include "entities/terrain/SteelWall.hpp"
 #include "collision/CollisionManager.hpp"
 #include "mocks/ScriptedInput.hpp"
 
@@ -20,7 +19,7 @@
 namespace tank::test {
 namespace {
 
-void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode scancode) {
+void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, Scancode scancode) {
     input.setKeyDown(scancode, true);
     manager.handleInput(input);
     input.advanceFrame();
@@ -31,7 +30,7 @@ void pressKeyOnce(GameStateManager& manager, ScriptedInput& input, SDL_Scancode
 PlayingState* startCampaignLevel1(GameStateManager& manager, ScriptedInput& input) {
     manager.pushState(std::make_unique<MenuState>(manager));
     manager.update(0.0f);
-    pressKeyOnce(manager, input, SDL_SCANCODE_1);
+    pressKeyOnce(manager, input, Scancode::Num1);
     manager.update(0.0f);  // -> StageState(1)
     manager.update(3.0f);
     manager.update(0.0f);  // -> PlayingState(1)
@@ -61,21 +60,9 @@ std::string writeSpawnBlockedLevelFile() {
 }
 
 bool overlapsSolidTerrain(const PlayingState& state, const Rectangle& bounds) {
-    for (const auto& terrain : state.terrains_) {
-        if (!terrain->isActive() || terrain->isDestroyed() || terrain->isTankPassable()) {
-            continue;
-        }
-        if (auto* brick = dynamic_cast<BrickWall*>(terrain.get())) {
-            if (brick->intersectsSolid(bounds)) {
-                return true;
-            }
-            continue;
-        }
-        if (CollisionManager::checkAABB(bounds, terrain->getBounds())) {
-            return true;
-        }
-    }
-    return false;
+    return state.terrainMap_.anyOf(bounds, [](TerrainCell, TerrainType type) {
+        return getTerrainMaterial(type).blocksTanks;
+    });
 }
 
 } // namespace
@@ -96,10 +83,11 @@ TEST(SpawnTerrainCollisionTest, SpawningTankCannotDriveIntoWall) {
 
     // Place a steel wall directly above the spawn point
     const Vector2 spawnPos = tank.getSpawnPosition();
-    playing->terrains_.push_back(
-        std::make_unique<SteelWall>(Vector2(spawnPos.x, spawnPos.y - Constants::CELL_SIZE)));
-    const ITerrain* wall = playing->terrains_.back().get();
-    const Rectangle wallBounds = wall->getBounds();
+    const TerrainCell wall{static_cast<int>(spawnPos.x) / Constants::CELL_SIZE,
+                           static_cast<int>(spawnPos.y) / Constants::CELL_SIZE - 1};
+    playing->setTerrainCell(wall.x, wall.y, TerrainType::Steel);
+    const Rectangle wallBounds = TerrainMap::getCellBounds(wall);
+    ASSERT_EQ(wallBounds.x, spawnPos.x);
 
     // Drive upward far longer than the spawn animation lasts
     for (int i = 0; i < 60; ++i) {
@@ -192,11 +180,10 @@ TEST(SpawnTerrainCollisionTest, FortifyBaseDoesNotBuryTank) {
 
     // Simulate the base-ring bricks having been shot away, then park the
     // player on the freed cells above-left of the base.
-    Level& level = *state.level_;
-    level.setTerrainAt(baseX - 1, baseY - 1, TerrainType::Empty);
-    level.setTerrainAt(baseX, baseY - 1, TerrainType::Empty);
-    level.setTerrainAt(baseX - 1, baseY, TerrainType::Empty);
-    state.createTerrain();
+    const Level& level = *state.level_;
+    state.setTerrainCell(baseX - 1, baseY - 1, TerrainType::Empty);
+    state.setTerrainCell(baseX, baseY - 1, TerrainType::Empty);
+    state.setTerrainCell(baseX - 1, baseY, TerrainType::Empty);
 
     const Vector2 parked(static_cast<float>((baseX - 1) * Constants::CELL_SIZE),
                          static_cast<float>((baseY - 1) * Constants::CELL_SIZE));
@@ -228,11 +215,10 @@ TEST(SpawnTerrainCollisionTest, RestoreFortifiedBaseDoesNotBuryTank) {
     // Fortify with the player far away, then blast a gap into the steel ring
     // and park on the freed cells before the shield expires.
     state.fortifyBase();
-    Level& level = *state.level_;
-    level.setTerrainAt(baseX - 1, baseY - 1, TerrainType::Empty);
-    level.setTerrainAt(baseX, baseY - 1, TerrainType::Empty);
-    level.setTerrainAt(baseX - 1, baseY, TerrainType::Empty);
-    state.createTerrain();
+    const Level& level = *state.level_;
+    state.setTerrainCell(baseX - 1, baseY - 1, TerrainType::Empty);
+    state.setTerrainCell(baseX, baseY - 1, TerrainType::Empty);
+    state.setTerrainCell(baseX - 1, baseY, TerrainType::Empty);
 
     const Vector2 parked(static_cast<float>((baseX - 1) * Constants::CELL_SIZE),
                          static_cast<float>((baseY - 1) * Constants::CELL_SIZE));
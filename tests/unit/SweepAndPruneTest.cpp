@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "collision/SweepAndPrune.hpp"
+#include "states/GameStateManager.hpp"
+#include "utils/Random.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+using Pair = SweepAndPrune::Pair;
+
+std::vector<std::tuple<int, int>> indexPairs(const std::vector<Pair>& pairs) {
+    std::vector<std::tuple<int, int>> result;
+    for (const Pair& pair : pairs) {
+        result.emplace_back(pair.indexA, pair.indexB);
+    }
+    return result;
+}
+
+std::vector<std::tuple<int, int>> bruteForcePairs(const std::vector<Rectangle>& boxes) {
+    std::vector<std::tuple<int, int>> result;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        for (size_t j = i + 1; j < boxes.size(); ++j) {
+            if (boxes[i].intersects(boxes[j])) {
+                result.emplace_back(static_cast<int>(i), static_cast<int>(j));
+            }
+        }
+    }
+    return result;
+}
+
+void submitAll(SweepAndPrune& broadphase, const std::vector<Rectangle>& boxes) {
+    broadphase.beginFrame();
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        broadphase.submit(SweepAndPrune::makeKey(EntityKind::Bullet, static_cast<int>(i)), EntityKind::Bullet,
+                          static_cast<int>(i), boxes[i]);
+    }
+}
+
+} // namespace
+
+TEST(SweepAndPruneTest, MatchesBruteForceAcrossCoherentFrames) {
+    RandomStream random(11);
+    std::vector<Rectangle> boxes;
+    std::vector<Vector2> velocities;
+    for (int i = 0; i < 300; ++i) {
+        boxes.emplace_back(random.nextFloat() * 434.0f, random.nextFloat() * 434.0f, 8.0f, 8.0f);
+        velocities.emplace_back(-3.0f + random.nextFloat() * 6.0f, -3.0f + random.nextFloat() * 6.0f);
+    }
+
+    SweepAndPrune broadphase;
+    std::vector<Pair> pairs;
+    submitAll(broadphase, boxes);
+    broadphase.findPairs(pairs);
+    const size_t initialSwaps = broadphase.getLastSwapCount();
+    ASSERT_EQ(indexPairs(pairs), bruteForcePairs(boxes));
+
+    for (int frame = 0; frame < 20; ++frame) {
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            boxes[i] = boxes[i].moved(velocities[i]);
+        }
+        submitAll(broadphase, boxes);
+        broadphase.findPairs(pairs);
+        ASSERT_EQ(indexPairs(pairs), bruteForcePairs(boxes)) << "frame " << frame;
+        // The previous order is nearly right, so few entries move
+        EXPECT_LT(broadphase.getLastSwapCount(), initialSwaps / 4);
+    }
+}
+
+TEST(SweepAndPruneTest, DropsUnsubmittedProxiesAndHonoursTheFilter) {
+    SweepAndPrune broadphase;
+    broadphase.setPairFilter(EntityKind::PowerUp, EntityKind::Bullet, false);
+    std::vector<Pair> pairs;
+
+    broadphase.beginFrame();
+    broadphase.submit(SweepAndPrune::makeKey(EntityKind::Bullet, 1), EntityKind::Bullet, 0, Rectangle(0.0f, 0.0f, 8.0f, 8.0f));
+    broadphase.submit(SweepAndPrune::makeKey(EntityKind::EnemyTank, 1), EntityKind::EnemyTank, 0, Rectangle(4.0f, 4.0f, 34.0f, 34.0f));
+    broadphase.submit(SweepAndPrune::makeKey(EntityKind::PowerUp, 2), EntityKind::PowerUp, 0, Rectangle(2.0f, 2.0f, 34.0f, 34.0f));
+    // Touching edges are not an overlap
+    broadphase.submit(SweepAndPrune::makeKey(EntityKind::Bullet, 3), EntityKind::Bullet, 1, Rectangle(38.0f, 4.0f, 8.0f, 8.0f));
+    broadphase.findPairs(pairs);
+
+    ASSERT_EQ(pairs.size(), 2u);
+    // Same id, different kind: separate proxies; pairs come out kind-ordered
+    EXPECT_EQ(pairs[0].kindA, EntityKind::EnemyTank);
+    EXPECT_EQ(pairs[0].kindB, EntityKind::Bullet);
+    EXPECT_EQ(pairs[0].indexB, 0);
+    EXPECT_EQ(pairs[1].kindA, EntityKind::EnemyTank);
+    EXPECT_EQ(pairs[1].kindB, EntityKind::PowerUp);
+
+    broadphase.beginFrame();
+    broadphase.submit(SweepAndPrune::makeKey(EntityKind::Bullet, 1), EntityKind::Bullet, 0, Rectangle(0.0f, 0.0f, 8.0f, 8.0f));
+    broadphase.submit(SweepAndPrune::makeKey(EntityKind::PowerUp, 2), EntityKind::PowerUp, 0, Rectangle(2.0f, 2.0f, 34.0f, 34.0f));
+    broadphase.findPairs(pairs);
+
+    EXPECT_EQ(broadphase.getProxyCount(), 2u);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST(SweepAndPruneTest, PlayingStateResolvesABulletSwarmThroughCandidatePairs) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->update(10.0f);  // Finish the spawn animation
+    state.player1_->setPosition(Vector2(20.0f, 400.0f));
+    state.player1_->makeInvincible(0.0f);
+
+    // Two facing columns of bullets; each pair meets head on this tick
+    for (int i = 0; i < 40; ++i) {
+        const float x = 20.0f + 10.0f * static_cast<float>(i);
+        state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(x, 200.0f), Direction::Down, nullptr));
+        state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(x, 212.0f), Direction::Up, nullptr));
+    }
+    // A stray bullet well away from the rest
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(300.0f, 40.0f), Direction::Right, nullptr));
+    for (auto& bullet : state.bullets_) {
+        bullet->update(Constants::FIXED_DELTA_TIME);
+    }
+
+    state.powerUpManager_.spawn(Vector2(30.0f, 400.0f), PowerUpType::Star);
+    state.checkCollisions();
+
+    for (size_t i = 0; i + 1 < state.bullets_.size(); ++i) {
+        EXPECT_FALSE(state.bullets_[i]->isAlive()) << "bullet " << i;
+    }
+    EXPECT_TRUE(state.bullets_.back()->isAlive());
+    EXPECT_EQ(state.broadphase_.getProxyCount(), state.bullets_.size() + 2);  // + player + power-up
+    EXPECT_EQ(state.powerUpManager_.getCount(), 0u) << "picked up through a player/power-up pair";
+}
+
+} // namespace tank::test
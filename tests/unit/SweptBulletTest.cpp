@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "collision/CollisionManager.hpp"
+#include "entities/terrain/TerrainMap.hpp"
+#include "graphics/SpriteSheet.hpp"
+#include "states/GameStateManager.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+// A playing state with an empty arena
+void clearArena(PlayingState& state) {
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.effects_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+    state.player1_->setPosition(Vector2(400.0f, 400.0f));
+}
+
+Bullet* fireBullet(PlayingState& state, const Vector2& position, Direction direction, float speed, ITank* owner) {
+    auto bullet = std::make_unique<Bullet>(state.world_, position, direction, owner);
+    bullet->setSpeed(speed);
+    Bullet* raw = bullet.get();
+    state.bullets_.push_back(std::move(bullet));
+    return raw;
+}
+
+} // namespace
+
+TEST(SweptBulletTest, SweepAABBReportsFirstOverlap) {
+    const Rectangle box(0.0f, 0.0f, 8.0f, 8.0f);
+    const Rectangle target(20.0f, 0.0f, 4.0f, 8.0f);
+
+    const auto hit = CollisionManager::sweepAABB(box, Vector2(40.0f, 0.0f), target);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_FLOAT_EQ(*hit, 12.0f / 40.0f);
+
+    // Ending exactly in contact is not an overlap; passing beside is a miss
+    EXPECT_FALSE(CollisionManager::sweepAABB(box, Vector2(12.0f, 0.0f), target).has_value());
+    EXPECT_FALSE(CollisionManager::sweepAABB(box.moved(Vector2(0.0f, 8.0f)), Vector2(40.0f, 0.0f), target).has_value());
+    // Already overlapping, or not moving at all, degrades to the AABB test
+    EXPECT_FLOAT_EQ(*CollisionManager::sweepAABB(target, Vector2(-5.0f, 0.0f), target), 0.0f);
+    EXPECT_FALSE(CollisionManager::sweepAABB(box, Vector2(), target).has_value());
+}
+
+TEST(SweptBulletTest, MapSweepVisitsSlabsInTravelOrderAndStopsEarly) {
+    TerrainMap map;
+    map.set(8, 10, TerrainType::Steel);
+    map.set(3, 10, TerrainType::Steel);
+
+    const Rectangle box(0.0f, 10 * kCell + 4.0f, 8.0f, 8.0f);
+    const Vector2 delta(12 * kCell, 0.0f);
+    float earliest = 1.0f;
+    std::vector<TerrainCell> visited;
+    map.sweep(box, delta, earliest, [&](TerrainCell cell, TerrainType) {
+        visited.push_back(cell);
+        if (const auto time = CollisionManager::sweepAABB(box, delta, TerrainMap::getCellBounds(cell))) {
+            earliest = std::min(earliest, *time);
+        }
+    });
+
+    ASSERT_EQ(visited.size(), 1u);
+    EXPECT_EQ(visited[0], (TerrainCell{3, 10}));
+    EXPECT_LT(earliest, 1.0f);
+}
+
+TEST(SweptBulletTest, FastBulletCannotTunnelThroughABrickCorner) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    clearArena(state);
+
+    // One live corner, 17 px tall, at rows 102..119
+    state.setTerrainCell(6, 6, TerrainType::Brick);
+    // 40 px per tick: from y=130 the end box (90..98) lies wholly past it
+    Bullet* bullet = fireBullet(state, Vector2(6 * kCell + 4.0f, 130.0f), Direction::Up, 40.0f, nullptr);
+    bullet->update(Constants::FIXED_DELTA_TIME);
+    ASSERT_FALSE(CollisionManager::checkAABB(bullet->getBounds(), Rectangle(6 * kCell, 6 * kCell, kCell, kCell)));
+
+    state.checkCollisions();
+
+    EXPECT_FALSE(bullet->isAlive());
+    EXPECT_FLOAT_EQ(bullet->getPosition().y, 7 * kCell) << "stopped at the contact point";
+    EXPECT_EQ(state.terrainMap_.getTerrainCount(), 0u);
+}
+
+TEST(SweptBulletTest, BulletLeavingTheMapTracesItsLastSegmentFirst) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    clearArena(state);
+
+    // A brick strip along the top edge, thinner than one tick of travel
+    state.setTerrainCell(6, 0, TerrainType::Brick);
+    Bullet* blocked = fireBullet(state, Vector2(6 * kCell + 4.0f, 30.0f), Direction::Up, 40.0f, nullptr);
+    Bullet* clear = fireBullet(state, Vector2(20 * kCell + 4.0f, 30.0f), Direction::Up, 40.0f, nullptr);
+    state.updateEntities(Constants::FIXED_DELTA_TIME);
+    ASSERT_TRUE(blocked->isAlive()) << "kept alive until its segment is traced";
+    EXPECT_FLOAT_EQ(clear->getPosition().y, -static_cast<float>(Sprites::Bullet::SIZE)) << "clipped to the edge";
+
+    state.checkCollisions();
+
+    EXPECT_FALSE(blocked->isAlive());
+    EXPECT_FLOAT_EQ(blocked->getPosition().y, kCell) << "stopped at the contact point";
+    EXPECT_EQ(state.terrainMap_.get(6, 0), TerrainType::Empty);
+    EXPECT_FALSE(clear->isAlive()) << "retired once contacts are resolved";
+    EXPECT_EQ(state.effects_.size(), 1u) << "only the hit explodes";
+}
+
+TEST(SweptBulletTest, FastBulletHitsTheFirstTankOnItsPath) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    clearArena(state);
+
+    state.enemies_.push_back(std::make_unique<EnemyTank>(state.world_, Vector2(100.0f, 200.0f), EnemyType::Basic));
+    state.enemies_.push_back(std::make_unique<EnemyTank>(state.world_, Vector2(160.0f, 200.0f), EnemyType::Basic));
+    EnemyTank* first = state.enemies_[0].get();
+    EnemyTank* second = state.enemies_[1].get();
+    first->update(10.0f);  // Finish the spawn animation
+    second->update(10.0f);
+    const int firstHealth = first->getHealth();
+    const int secondHealth = second->getHealth();
+
+    // Jumps from x=60 clean over the first tank, ending inside the second
+    Bullet* bullet = fireBullet(state, Vector2(60.0f, 210.0f), Direction::Right, 110.0f, state.player1_.get());
+    bullet->update(Constants::FIXED_DELTA_TIME);
+    state.checkCollisions();
+
+    EXPECT_FALSE(bullet->isAlive());
+    EXPECT_LT(first->getHealth(), firstHealth);
+    EXPECT_EQ(second->getHealth(), secondHealth);
+}
+
+TEST(SweptBulletTest, HeadOnBulletsCollideEvenWhenTheyCrossInOneTick) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+    clearArena(state);
+
+    Bullet* up = fireBullet(state, Vector2(200.0f, 200.0f), Direction::Up, 30.0f, nullptr);
+    Bullet* down = fireBullet(state, Vector2(200.0f, 180.0f), Direction::Down, 30.0f, nullptr);
+    up->update(Constants::FIXED_DELTA_TIME);
+    down->update(Constants::FIXED_DELTA_TIME);
+    ASSERT_FALSE(CollisionManager::checkAABB(up->getBounds(), down->getBounds()));
+
+    state.checkCollisions();
+
+    EXPECT_FALSE(up->isAlive());
+    EXPECT_FALSE(down->isAlive());
+}
+
+} // namespace tank::test
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+#include "states/PlayingState.hpp"
+#undef private
+#undef protected
+
+#include "entities/terrain/TerrainMap.hpp"
+#include "states/GameStateManager.hpp"
+
+#include <vector>
+
+namespace tank::test {
+namespace {
+
+constexpr float kCell = static_cast<float>(Constants::CELL_SIZE);
+
+std::vector<TerrainCell> queryMap(const TerrainMap& map, const Rectangle& area) {
+    std::vector<TerrainCell> found;
+    map.anyOf(area, [&found](TerrainCell cell, TerrainType) {
+        found.push_back(cell);
+        return false;
+    });
+    return found;
+}
+
+} // namespace
+
+TEST(TerrainMapTest, MaterialsDescribeEachTerrainType) {
+    EXPECT_FALSE(getTerrainMaterial(TerrainType::Empty).blocksTanks);
+    EXPECT_TRUE(getTerrainMaterial(TerrainType::Water).blocksTanks);
+    EXPECT_FALSE(getTerrainMaterial(TerrainType::Water).blocksBullets);
+    EXPECT_FALSE(getTerrainMaterial(TerrainType::Grass).blocksTanks);
+    EXPECT_EQ(getTerrainMaterial(TerrainType::Grass).layer, RenderLayer::Grass);
+
+    const TerrainMaterial& brick = getTerrainMaterial(TerrainType::Brick);
+    EXPECT_TRUE(brick.isBrokenBy(1, 1));
+    const TerrainMaterial& steel = getTerrainMaterial(TerrainType::Steel);
+    EXPECT_FALSE(steel.isBrokenBy(2, 100));
+    EXPECT_FALSE(steel.isBrokenBy(3, 99));
+    EXPECT_TRUE(steel.isBrokenBy(3, 100));
+    EXPECT_FALSE(getTerrainMaterial(TerrainType::Water).isBrokenBy(3, 1000));
+
+    EXPECT_TRUE(brick.isBrokenByBasicShot());
+    EXPECT_FALSE(steel.isBrokenByBasicShot());
+    EXPECT_FALSE(getTerrainMaterial(TerrainType::Water).isBrokenByBasicShot());
+}
+
+TEST(TerrainMapTest, OnlyCellsUnderTheQueryAreVisited) {
+    TerrainMap map;
+    map.set(1, 1, TerrainType::Steel);
+    map.set(20, 20, TerrainType::Steel);
+    map.set(-1, 0, TerrainType::Steel);  // Outside, ignored
+    EXPECT_EQ(map.getTerrainCount(), 2u);
+    EXPECT_EQ(map.get(-1, 0), TerrainType::Empty);
+
+    const auto found = queryMap(map, Rectangle(0.0f, 0.0f, 3 * kCell, 3 * kCell));
+    ASSERT_EQ(found.size(), 1u);
+    EXPECT_EQ(found[0], (TerrainCell{1, 1}));
+
+    // Edges that only touch do not overlap, as with Rectangle::intersects
+    EXPECT_TRUE(queryMap(map, Rectangle(2 * kCell, kCell, kCell, kCell)).empty());
+    EXPECT_TRUE(queryMap(map, Rectangle(-50.0f, -50.0f, 50.0f + kCell, 50.0f + kCell)).empty());
+}
+
+TEST(TerrainMapTest, ClearedCellIsNoLongerReported) {
+    TerrainMap map;
+    map.set(0, 0, TerrainType::Brick);
+    map.set(0, 0, TerrainType::Empty);
+    map.set(0, 0, TerrainType::Empty);  // Clearing twice is a no-op
+
+    EXPECT_EQ(map.getTerrainCount(), 0u);
+    EXPECT_TRUE(queryMap(map, Rectangle(0.0f, 0.0f, 2 * kCell, 2 * kCell)).empty());
+}
+
+TEST(TerrainMapTest, PlayingStateMapMatchesTheLevel) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+
+    ASSERT_GT(state.terrainMap_.getTerrainCount(), 0u);
+    for (int y = 0; y < state.level_->getHeight(); ++y) {
+        for (int x = 0; x < state.level_->getWidth(); ++x) {
+            const TerrainType expected = state.level_->getTerrainAt(x, y);
+            if (expected == TerrainType::Base) {
+                continue;  // The base is its own entity
+            }
+            EXPECT_EQ(state.terrainMap_.get(x, y), expected) << "cell (" << x << "," << y << ")";
+        }
+    }
+}
+
+TEST(TerrainMapTest, DestroyedBrickCellLeavesTheMap) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+
+    state.setTerrainCell(0, 0, TerrainType::Brick);
+    ASSERT_EQ(state.terrainMap_.getTerrainCount(), 1u);
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(4.0f, 4.0f), Direction::Up, nullptr, 0));
+
+    state.checkCollisions();
+    EXPECT_EQ(state.terrainMap_.get(0, 0), TerrainType::Empty);
+    EXPECT_EQ(state.terrainMap_.getTerrainCount(), 0u);
+    EXPECT_FALSE(state.isTerrainBlockingTank(Rectangle(0.0f, 0.0f, kCell, kCell)));
+}
+
+TEST(TerrainMapTest, SteelStopsBulletsUntilTheyAreFullyUpgraded) {
+    GameStateManager manager;
+    PlayingState state(manager, /*levelNumber=*/1, /*twoPlayer=*/false, /*useWaveGenerator=*/false);
+    state.enter();
+
+    state.bullets_.clear();
+    state.enemies_.clear();
+    state.clearTerrain();
+    state.base_.reset();
+
+    state.setTerrainCell(0, 0, TerrainType::Steel);
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(4.0f, 4.0f), Direction::Up, nullptr, 0));
+    state.checkCollisions();
+    EXPECT_FALSE(state.bullets_[0]->isAlive());
+    EXPECT_EQ(state.terrainMap_.get(0, 0), TerrainType::Steel);
+
+    state.bullets_.push_back(std::make_unique<Bullet>(state.world_, Vector2(4.0f, 4.0f), Direction::Up, nullptr, 3));
+    state.checkCollisions();
+    EXPECT_EQ(state.terrainMap_.get(0, 0), TerrainType::Empty);
+}
+
+} // namespace tank::test